@@ -0,0 +1,111 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "bench-support.hpp"
+#include "arena-list.hpp"
+
+// ****************************** Arena Allocated Lists *********************************************
+// `ArenaList` built by inserting at random positions (a long lived list), sizes 1K ... 10M nodes:
+// - heap      : one `new_delete_resource` allocation per node
+// - arena     : nodes from the own monotonic arena, allocation order differs from the traversal order
+// - compacted : arena list after `compact()`, the traversal is a sequential memory scan
+
+enum class NodePlacement { heap, arena, compacted };
+
+// Sizes 1K ... 10M nodes
+static void NodeCounts(benchmark::internal::Benchmark *benchmark) {
+    for (int64_t count: {1000, 10000, 100000, 1000000, 10000000}) {
+        benchmark->Arg(count);
+    }
+}
+
+// Inserts every value before a random existing node, so the traversal order does not follow the allocation order
+static void Build(ArenaList<int64_t> &list, size_t count) {
+    std::mt19937 random(42);
+    std::vector<ArenaList<int64_t>::iterator> positions;
+    positions.reserve(count);
+    for (size_t index = 0; index < count; ++index) {
+        auto position = positions.empty() ? list.end() : positions[random() % positions.size()];
+        positions.push_back(list.insert(position, static_cast<int64_t>(index)));
+    }
+}
+
+static std::pmr::memory_resource * Resource(NodePlacement placement) {
+    return placement == NodePlacement::heap ? std::pmr::new_delete_resource() : nullptr;
+}
+
+template<NodePlacement placement>
+void BM_ArenaListTraverse(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    ArenaList<int64_t> list(Resource(placement));
+    Build(list, count);
+    if (placement == NodePlacement::compacted) {
+        list.compact();
+    }
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (int64_t value: list) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, count, sizeof(int64_t));
+}
+
+// Reverse traversal: native reverse iterators step with `prev()`, `std::reverse_iterator` copies the iterator and
+// steps back once more on every dereference
+template<NodePlacement placement, bool is_native>
+void BM_ArenaListReverseTraverse(benchmark::State &state) {
+    typedef std::reverse_iterator<ArenaList<int64_t>::const_iterator> wrapped_iterator;
+    const size_t count = static_cast<size_t>(state.range(0));
+    ArenaList<int64_t> list(Resource(placement));
+    Build(list, count);
+    const ArenaList<int64_t> &constList = list;
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        if constexpr (is_native) {
+            for (auto i = constList.rbegin(), end = constList.rend(); i != end; ++i) {
+                sum += *i;
+            }
+        } else {
+            for (auto i = wrapped_iterator(constList.end()), end = wrapped_iterator(constList.begin()); i != end; ++i) {
+                sum += *i;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, count, sizeof(int64_t));
+}
+
+template<NodePlacement placement>
+void BM_ArenaListPushBack(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        ArenaList<int64_t> list(Resource(placement));
+        for (size_t index = 0; index < count; ++index) {
+            list.push_back(static_cast<int64_t>(index));
+        }
+        benchmark::DoNotOptimize(list.size());
+    }
+
+    SetElementCounters(state, count, sizeof(int64_t));
+}
+
+BENCHMARK_TEMPLATE(BM_ArenaListTraverse, NodePlacement::heap)->Apply(NodeCounts);
+BENCHMARK_TEMPLATE(BM_ArenaListTraverse, NodePlacement::arena)->Apply(NodeCounts);
+BENCHMARK_TEMPLATE(BM_ArenaListTraverse, NodePlacement::compacted)->Apply(NodeCounts);
+BENCHMARK_TEMPLATE(BM_ArenaListReverseTraverse, NodePlacement::arena, true)->Apply(NodeCounts);
+BENCHMARK_TEMPLATE(BM_ArenaListReverseTraverse, NodePlacement::arena, false)->Apply(NodeCounts);
+BENCHMARK_TEMPLATE(BM_ArenaListPushBack, NodePlacement::heap)->Apply(NodeCounts);
+BENCHMARK_TEMPLATE(BM_ArenaListPushBack, NodePlacement::arena)->Apply(NodeCounts);
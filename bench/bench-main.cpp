@@ -0,0 +1,16 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT 
+
+#include <benchmark/benchmark.h>
+
+// Use `--benchmark_format=json` or `--benchmark_out=<file> --benchmark_out_format=json|csv`
+// to get machine readable results for tracking regressions between releases
+auto main(int argc, char **argv) -> int{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
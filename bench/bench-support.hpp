@@ -0,0 +1,33 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT 
+
+#ifndef _tmc_bench_bench_support_hpp_
+#define _tmc_bench_bench_support_hpp_
+
+#include <cstddef>
+#include <cstdint>
+#include <benchmark/benchmark.h>
+
+// Element counts of the size sweep: 1K, 10K, ... 100M elements
+inline void ElementCounts(benchmark::internal::Benchmark *benchmark) {
+    for (int64_t count = 1000; count <= 100000000; count *= 10) {
+        benchmark->Arg(count);
+    }
+}
+
+// Reports the per element metrics of a benchmark run:
+// - `ns_per_element`  : wall clock time per processed element
+// - `bytes_per_cycle` : touched bytes per CPU cycle (memory throughput)
+// Both are rate counters: the console output appends a `/s` or `s` unit, the JSON/CSV values are plain
+// `bytesPerElement` is fractional for packed elements, e.g. 1.6 for 12 bit elements
+inline void SetElementCounters(benchmark::State &state, size_t elementCount, double bytesPerElement) {
+    const double elements = static_cast<double>(elementCount);
+    const double bytes = elements * bytesPerElement;
+    const double cyclesPerSecond = benchmark::CPUInfo::Get().cycles_per_second;
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * elementCount));
+    state.counters["ns_per_element"] = benchmark::Counter(elements * 1e-9, benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    state.counters["bytes_per_cycle"] = benchmark::Counter(bytes / cyclesPerSecond, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+#endif
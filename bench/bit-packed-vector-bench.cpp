@@ -0,0 +1,169 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/bit-packed-vector.hpp>
+#include "bench-support.hpp"
+
+// ****************************** Benchmark Subjects *********************************************
+// Scans of small integers (values < 2^Bits) stored in a `std::vector<uint16_t>` (the baseline) and in a
+// `bit_packed_vector<Bits>`, the packed vector once with the `std` algorithms (one proxy per element) and once with the
+// word at a time `tmc::foundation` algorithms. `bytes_per_element` reports the memory of the container per element.
+
+struct StdAlgorithms {
+    template<typename TIterator, typename T>
+    static T accumulate(TIterator first, TIterator last, T init) { return std::accumulate(first, last, init); }
+
+    template<typename TIterator, typename T>
+    static auto count(TIterator first, TIterator last, const T &value) { return std::count(first, last, value); }
+
+    template<typename TIterator, typename TOutputIterator>
+    static TOutputIterator copy(TIterator first, TIterator last, TOutputIterator result) { return std::copy(first, last, result); }
+
+    template<typename TIterator, typename T>
+    static void fill(TIterator first, TIterator last, const T &value) { std::fill(first, last, value); }
+};
+
+struct WordAlgorithms {
+    template<typename TIterator, typename T>
+    static T accumulate(TIterator first, TIterator last, T init) { return tmc::foundation::accumulate(first, last, init); }
+
+    template<typename TIterator, typename T>
+    static auto count(TIterator first, TIterator last, const T &value) { return tmc::foundation::count(first, last, value); }
+
+    template<typename TIterator, typename TOutputIterator>
+    static TOutputIterator copy(TIterator first, TIterator last, TOutputIterator result) { return tmc::foundation::copy(first, last, result); }
+
+    template<typename TIterator, typename T>
+    static void fill(TIterator first, TIterator last, const T &value) { tmc::foundation::fill(first, last, value); }
+};
+
+// Element values of all subjects: an irregular sequence below 2^bits
+static uint16_t PackedValue(size_t index, unsigned bits) {
+    return static_cast<uint16_t>(((index * 2654435761u) >> 7) & ((1u << bits) - 1));
+}
+
+// Baseline: `std::vector<uint16_t>` holding 12 bit values
+struct VectorSubject {
+    typedef StdAlgorithms algorithms;
+    std::vector<uint16_t> container;
+
+    explicit VectorSubject(size_t count) {
+        container.reserve(count);
+        for (size_t index = 0; index < count; ++index) {
+            container.push_back(PackedValue(index, 12));
+        }
+    }
+
+    size_t size_bytes() const { return container.size() * sizeof(uint16_t); }
+};
+
+template<unsigned Bits, typename TAlgorithms>
+struct PackedSubject {
+    typedef TAlgorithms algorithms;
+    tmc::foundation::bit_packed_vector<Bits> container;
+
+    explicit PackedSubject(size_t count) {
+        container.reserve(count);
+        for (size_t index = 0; index < count; ++index) {
+            container.push_back(static_cast<typename tmc::foundation::bit_packed_vector<Bits>::value_type>(PackedValue(index, Bits)));
+        }
+    }
+
+    size_t size_bytes() const { return container.size_bytes(); }
+};
+
+typedef PackedSubject<12, StdAlgorithms> Packed12StdSubject;
+typedef PackedSubject<12, WordAlgorithms> Packed12WordSubject;
+typedef PackedSubject<7, WordAlgorithms> Packed7WordSubject;
+typedef PackedSubject<3, WordAlgorithms> Packed3WordSubject;
+typedef PackedSubject<1, WordAlgorithms> Packed1WordSubject;
+
+static void PackedCounts(benchmark::internal::Benchmark *benchmark) {
+    for (int64_t count = 10000; count <= 10000000; count *= 10) {
+        benchmark->Arg(count);
+    }
+}
+
+template<typename TSubject>
+static void SetPackedCounters(benchmark::State &state, const TSubject &subject, size_t count, double extraBytesPerElement = 0) {
+    const double bytesPerElement = static_cast<double>(subject.size_bytes()) / static_cast<double>(count);
+    SetElementCounters(state, count, bytesPerElement + extraBytesPerElement);
+    state.counters["bytes_per_element"] = bytesPerElement;
+}
+
+
+// ****************************** Algorithms *********************************************
+
+template<typename TSubject>
+void BM_PackedAccumulate(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const TSubject subject(count);
+
+    for (auto _ : state) {
+        uint64_t sum = TSubject::algorithms::accumulate(subject.container.begin(), subject.container.end(), uint64_t{0});
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetPackedCounters(state, subject, count);
+}
+
+template<typename TSubject>
+void BM_PackedCount(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const TSubject subject(count);
+
+    for (auto _ : state) {
+        auto found = TSubject::algorithms::count(subject.container.begin(), subject.container.end(), 1);
+        benchmark::DoNotOptimize(found);
+    }
+
+    SetPackedCounters(state, subject, count);
+}
+
+template<typename TSubject>
+void BM_PackedCopy(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const TSubject subject(count);
+    std::vector<uint16_t> target(count);
+
+    for (auto _ : state) {
+        TSubject::algorithms::copy(subject.container.begin(), subject.container.end(), target.data());
+        benchmark::ClobberMemory();
+    }
+
+    SetPackedCounters(state, subject, count, sizeof(uint16_t));
+}
+
+template<typename TSubject>
+void BM_PackedFill(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    TSubject subject(count);
+
+    for (auto _ : state) {
+        TSubject::algorithms::fill(subject.container.begin(), subject.container.end(), 1);
+        benchmark::ClobberMemory();
+    }
+
+    SetPackedCounters(state, subject, count);
+}
+
+
+// ****************************** Registration *********************************************
+
+#define BENCHMARK_PACKED_SUBJECTS(FUNCTION) \
+  BENCHMARK_TEMPLATE(FUNCTION, VectorSubject)->Apply(PackedCounts); \
+  BENCHMARK_TEMPLATE(FUNCTION, Packed12StdSubject)->Apply(PackedCounts); \
+  BENCHMARK_TEMPLATE(FUNCTION, Packed12WordSubject)->Apply(PackedCounts); \
+  BENCHMARK_TEMPLATE(FUNCTION, Packed7WordSubject)->Apply(PackedCounts); \
+  BENCHMARK_TEMPLATE(FUNCTION, Packed3WordSubject)->Apply(PackedCounts); \
+  BENCHMARK_TEMPLATE(FUNCTION, Packed1WordSubject)->Apply(PackedCounts)
+
+BENCHMARK_PACKED_SUBJECTS(BM_PackedAccumulate);
+BENCHMARK_PACKED_SUBJECTS(BM_PackedCount);
+BENCHMARK_PACKED_SUBJECTS(BM_PackedCopy);
+BENCHMARK_PACKED_SUBJECTS(BM_PackedFill);
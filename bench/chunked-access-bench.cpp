@@ -0,0 +1,104 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+// Chunked access needs std::span - C++20 only
+#if __cplusplus >= 202002L
+
+#include <cstdint>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/custom-iterator-template.hpp>
+#include "bench-support.hpp"
+#include "custom-container-skeletons.hpp"
+#include "block-container.hpp"
+
+// ****************************** Benchmark Subjects *********************************************
+// Compares element wise loops (`operator*` and `operator++` per element) with batch loops over `next_chunk()`
+
+inline int64_t ElementValue(const CustomElement &element) { return element.GetValue(); }
+inline int64_t ElementValue(int64_t value) { return value; }
+
+template<typename TContainer>
+struct ChunkedSkeletonSubject {
+    TContainer container;
+
+    explicit ChunkedSkeletonSubject(size_t count) {
+        container.InternalData.reserve(count);
+        for (size_t index = 0; index < count; ++index) {
+            container.InternalData.push_back(CustomElement(static_cast<int>(index)));
+        }
+    }
+
+    typedef CustomElement element_type;
+};
+
+typedef ChunkedSkeletonSubject<CustomContainerWithContiguousIterator> ChunkedContiguousSubject;
+typedef ChunkedSkeletonSubject<CustomContainerWithRandomAccessIterator> ChunkedRandomAccessSubject;
+typedef ChunkedSkeletonSubject<CustomContainerWithChunkedInputIterator> ChunkedBufferedInputSubject;
+
+struct ChunkedBlockContainerSubject {
+    BlockContainer<int64_t> container;
+
+    explicit ChunkedBlockContainerSubject(size_t count) {
+        for (size_t index = 0; index < count; ++index) {
+            container.push_back(static_cast<int64_t>(index));
+        }
+    }
+
+    typedef int64_t element_type;
+};
+
+
+// ****************************** Algorithms *********************************************
+
+template<typename TSubject>
+void BM_ElementwiseSum(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    TSubject subject(count);
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (auto it = subject.container.begin(), last = subject.container.end(); it != last; ++it) {
+            sum += ElementValue(*it);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, count, sizeof(typename TSubject::element_type));
+}
+
+// Batches of up to 1024 elements - the inner loop runs over a span and vectorizes
+template<typename TSubject>
+void BM_ChunkedSum(benchmark::State &state) {
+    constexpr std::ptrdiff_t chunkSize = 1024;
+    const size_t count = static_cast<size_t>(state.range(0));
+    TSubject subject(count);
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        auto it = subject.container.begin();
+        const auto last = subject.container.end();
+        for (auto chunk = it.next_chunk(last, chunkSize); !chunk.empty(); chunk = it.next_chunk(last, chunkSize)) {
+            for (const auto &element: chunk) {
+                sum += ElementValue(element);
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, count, sizeof(typename TSubject::element_type));
+}
+
+
+// ****************************** Registration *********************************************
+
+#define BENCHMARK_CHUNKED_SUBJECT(SUBJECT) \
+  BENCHMARK_TEMPLATE(BM_ElementwiseSum, SUBJECT)->Apply(ElementCounts); \
+  BENCHMARK_TEMPLATE(BM_ChunkedSum, SUBJECT)->Apply(ElementCounts)
+
+BENCHMARK_CHUNKED_SUBJECT(ChunkedContiguousSubject);
+BENCHMARK_CHUNKED_SUBJECT(ChunkedRandomAccessSubject);
+BENCHMARK_CHUNKED_SUBJECT(ChunkedBufferedInputSubject);
+BENCHMARK_CHUNKED_SUBJECT(ChunkedBlockContainerSubject);
+
+#endif
@@ -0,0 +1,326 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT 
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/custom-iterator-template.hpp>
+#include "bench-support.hpp"
+#include "custom-container-skeletons.hpp"
+#include "sample-container.hpp"
+
+// Element value access for the different element types
+inline int ValueOf(const CustomElement &element) { return element.GetValue(); }
+inline int ValueOf(const SampleElement &element) { return element.member_; }
+inline void SetValueOf(CustomElement &element, int value) { element.SetValue(value); }
+inline void SetValueOf(SampleElement &element, int value) { element.member_ = value; }
+
+// ****************************** Benchmark Subjects *********************************************
+// Each subject owns `count` elements and exposes the iterators under test
+
+// Baseline: raw `T*` iteration
+struct RawPointerSubject {
+    typedef CustomElement element_type;
+    std::vector<CustomElement> data;
+
+    explicit RawPointerSubject(size_t count): data(count) {}
+
+    std::vector<CustomElement> & elements() { return data; }
+    CustomElement * begin() { return data.data(); }
+    CustomElement * end() { return data.data() + data.size(); }
+    std::reverse_iterator<CustomElement *> rbegin() { return std::reverse_iterator<CustomElement *>(end()); }
+    std::reverse_iterator<CustomElement *> rend() { return std::reverse_iterator<CustomElement *>(begin()); }
+};
+
+// Baseline: `std::vector<T>::iterator` iteration
+struct VectorIteratorSubject {
+    typedef CustomElement element_type;
+    std::vector<CustomElement> data;
+
+    explicit VectorIteratorSubject(size_t count): data(count) {}
+
+    std::vector<CustomElement> & elements() { return data; }
+    std::vector<CustomElement>::iterator begin() { return data.begin(); }
+    std::vector<CustomElement>::iterator end() { return data.end(); }
+    std::vector<CustomElement>::reverse_iterator rbegin() { return data.rbegin(); }
+    std::vector<CustomElement>::reverse_iterator rend() { return data.rend(); }
+};
+
+// The iterator state skeletons of the tests
+template<typename TContainer>
+struct SkeletonSubject {
+    typedef CustomElement element_type;
+    TContainer container;
+
+    explicit SkeletonSubject(size_t count) { container.InternalData.resize(count); }
+
+    std::vector<CustomElement> & elements() { return container.InternalData; }
+    typename TContainer::iterator begin() { return container.begin(); }
+    auto end() { return container.end(); }
+    auto rbegin() { return container.rbegin(); }
+    auto rend() { return container.rend(); }
+};
+
+typedef SkeletonSubject<CustomContainerWithInputIterator> InputIteratorSubject;
+typedef SkeletonSubject<CustomContainerWithForwardIterator> ForwardIteratorSubject;
+typedef SkeletonSubject<CustomContainerWithBidirectionalIterator> BidirectionalIteratorSubject;
+typedef SkeletonSubject<CustomContainerWithRandomAccessIterator> RandomAccessIteratorSubject;
+typedef SkeletonSubject<CustomContainerWithTrivialIteratorState> TrivialIteratorStateSubject;
+typedef SkeletonSubject<CustomContainerWithSentinel> SentinelSubject;
+typedef SkeletonSubject<CustomContainerWithNativeReverseIterator> NativeReverseIteratorSubject;
+
+// The native reverse skeleton wrapped in `std::reverse_iterator`: a state copy (connect / disconnect) per element access
+struct WrappedReverseIteratorSubject: NativeReverseIteratorSubject {
+    typedef std::reverse_iterator<CustomContainerWithNativeReverseIterator::iterator> reverse_iterator;
+
+    using NativeReverseIteratorSubject::NativeReverseIteratorSubject;
+
+    reverse_iterator rbegin() { return reverse_iterator(container.end()); }
+    reverse_iterator rend() { return reverse_iterator(container.begin()); }
+};
+#if __cplusplus >= 202002L
+typedef SkeletonSubject<CustomContainerWithContiguousIterator> ContiguousIteratorSubject;
+#endif
+
+// The `SampleContainer` of the sample
+struct SampleContainerSubject {
+    typedef SampleElement element_type;
+    std::vector<SampleElement> data;
+    SampleContainer container;
+
+    explicit SampleContainerSubject(size_t count): data(count), container(data.data(), data.size()) {}
+
+    std::vector<SampleElement> & elements() { return data; }
+    SampleContainer::iterator begin() { return container.begin(); }
+    SampleContainer::iterator end() { return container.end(); }
+    SampleContainer::reverse_iterator rbegin() { return container.rbegin(); }
+    SampleContainer::reverse_iterator rend() { return container.rend(); }
+};
+
+template<typename TSubject>
+void FillAscending(TSubject &subject) {
+    int value = 0;
+    for (auto &element: subject.elements()) {
+        SetValueOf(element, value++);
+    }
+}
+
+template<typename TSubject>
+std::vector<typename TSubject::element_type> MakeShuffled(TSubject &subject) {
+    FillAscending(subject);
+    std::vector<typename TSubject::element_type> shuffled = subject.elements();
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(42));
+    return shuffled;
+}
+
+
+// ****************************** Algorithms *********************************************
+
+template<typename TSubject>
+void BM_Accumulate(benchmark::State &state) {
+    typedef typename TSubject::element_type element_type;
+    TSubject subject(static_cast<size_t>(state.range(0)));
+    FillAscending(subject);
+
+    for (auto _ : state) {
+        int64_t sum = std::accumulate(subject.begin(), subject.end(), int64_t{0},
+            [](int64_t acc, const element_type &element) { return acc + ValueOf(element); });
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, subject.elements().size(), sizeof(element_type));
+}
+
+template<typename TSubject>
+void BM_Copy(benchmark::State &state) {
+    typedef typename TSubject::element_type element_type;
+    TSubject subject(static_cast<size_t>(state.range(0)));
+    FillAscending(subject);
+    std::vector<element_type> target(subject.elements().size());
+
+    for (auto _ : state) {
+        std::copy(subject.begin(), subject.end(), target.data());
+        benchmark::ClobberMemory();
+    }
+
+    SetElementCounters(state, subject.elements().size(), 2 * sizeof(element_type));
+}
+
+#if __cplusplus >= 202002L
+// Bulk copy through the raw element addresses of contiguous iterators - lowers to memmove
+template<typename TSubject>
+void BM_ContiguousCopy(benchmark::State &state) {
+    typedef typename TSubject::element_type element_type;
+    TSubject subject(static_cast<size_t>(state.range(0)));
+    FillAscending(subject);
+    std::vector<element_type> target(subject.elements().size());
+
+    for (auto _ : state) {
+        std::copy(std::to_address(subject.begin()), std::to_address(subject.end()), target.data());
+        benchmark::ClobberMemory();
+    }
+
+    SetElementCounters(state, subject.elements().size(), 2 * sizeof(element_type));
+}
+#endif
+
+template<typename TSubject>
+void BM_Find(benchmark::State &state) {
+    typedef typename TSubject::element_type element_type;
+    TSubject subject(static_cast<size_t>(state.range(0)));
+    FillAscending(subject);
+    const int needle = static_cast<int>(subject.elements().size()) - 1;
+
+    for (auto _ : state) {
+        auto found = std::find_if(subject.begin(), subject.end(),
+            [needle](const element_type &element) { return ValueOf(element) == needle; });
+        benchmark::DoNotOptimize(found);
+    }
+
+    SetElementCounters(state, subject.elements().size(), sizeof(element_type));
+}
+
+template<typename TSubject>
+void BM_Sort(benchmark::State &state) {
+    typedef typename TSubject::element_type element_type;
+    TSubject subject(static_cast<size_t>(state.range(0)));
+    const std::vector<element_type> shuffled = MakeShuffled(subject);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy(shuffled.begin(), shuffled.end(), subject.elements().begin());
+        state.ResumeTiming();
+
+        std::sort(subject.begin(), subject.end(),
+            [](const element_type &lhs, const element_type &rhs) { return ValueOf(lhs) < ValueOf(rhs); });
+        benchmark::ClobberMemory();
+    }
+
+    SetElementCounters(state, subject.elements().size(), sizeof(element_type));
+}
+
+// Reports per lookup - each lookup touches about log2(n) elements
+// Random access subjects only: forward and bidirectional iterators advance linearly, O(n) per lookup
+template<typename TSubject>
+void BM_LowerBound(benchmark::State &state) {
+    typedef typename TSubject::element_type element_type;
+    constexpr size_t lookupCount = 1024;
+    TSubject subject(static_cast<size_t>(state.range(0)));
+    FillAscending(subject);
+
+    std::vector<int> keys(lookupCount);
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> distribution(0, static_cast<int>(subject.elements().size()) - 1);
+    std::generate(keys.begin(), keys.end(), [&]() { return distribution(random); });
+
+    size_t probes = 1;
+    while ((size_t{1} << probes) < subject.elements().size()) {
+        ++probes;
+    }
+
+    for (auto _ : state) {
+        for (int key: keys) {
+            auto found = std::lower_bound(subject.begin(), subject.end(), key,
+                [](const element_type &element, int value) { return ValueOf(element) < value; });
+            benchmark::DoNotOptimize(found);
+        }
+    }
+
+    SetElementCounters(state, lookupCount, probes * sizeof(element_type));
+}
+
+// Range based for loop - compares against the sentinel of states implementing `is_end()`
+template<typename TSubject>
+void BM_RangeForLoop(benchmark::State &state) {
+    typedef typename TSubject::element_type element_type;
+    TSubject subject(static_cast<size_t>(state.range(0)));
+    FillAscending(subject);
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (const element_type &element: subject) {
+            sum += ValueOf(element);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, subject.elements().size(), sizeof(element_type));
+}
+
+template<typename TSubject>
+void BM_ReverseLoop(benchmark::State &state) {
+    typedef typename TSubject::element_type element_type;
+    TSubject subject(static_cast<size_t>(state.range(0)));
+    FillAscending(subject);
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (auto i = subject.rbegin(), end = subject.rend(); i != end; ++i) {
+            sum += ValueOf(*i);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, subject.elements().size(), sizeof(element_type));
+}
+
+
+// ****************************** Registration *********************************************
+// Every algorithm runs against the raw pointer and std::vector iterator baselines
+// and all subjects supporting the required iterator category
+
+#define BENCHMARK_SUBJECT(FUNCTION, SUBJECT) \
+  BENCHMARK_TEMPLATE(FUNCTION, SUBJECT)->Apply(ElementCounts)
+
+#if __cplusplus >= 202002L
+#define BENCHMARK_CONTIGUOUS_SUBJECTS(FUNCTION) \
+  BENCHMARK_SUBJECT(FUNCTION, RawPointerSubject); \
+  BENCHMARK_SUBJECT(FUNCTION, VectorIteratorSubject); \
+  BENCHMARK_SUBJECT(FUNCTION, ContiguousIteratorSubject)
+
+#define BENCHMARK_CONTIGUOUS_ITERATOR_SUBJECT(FUNCTION) \
+  BENCHMARK_SUBJECT(FUNCTION, ContiguousIteratorSubject);
+#else
+#define BENCHMARK_CONTIGUOUS_ITERATOR_SUBJECT(FUNCTION)
+#endif
+
+#define BENCHMARK_RANDOM_ACCESS_SUBJECTS(FUNCTION) \
+  BENCHMARK_CONTIGUOUS_ITERATOR_SUBJECT(FUNCTION) \
+  BENCHMARK_SUBJECT(FUNCTION, RawPointerSubject); \
+  BENCHMARK_SUBJECT(FUNCTION, VectorIteratorSubject); \
+  BENCHMARK_SUBJECT(FUNCTION, RandomAccessIteratorSubject); \
+  BENCHMARK_SUBJECT(FUNCTION, TrivialIteratorStateSubject); \
+  BENCHMARK_SUBJECT(FUNCTION, SampleContainerSubject)
+
+#define BENCHMARK_BIDIRECTIONAL_SUBJECTS(FUNCTION) \
+  BENCHMARK_RANDOM_ACCESS_SUBJECTS(FUNCTION); \
+  BENCHMARK_SUBJECT(FUNCTION, BidirectionalIteratorSubject)
+
+#define BENCHMARK_FORWARD_SUBJECTS(FUNCTION) \
+  BENCHMARK_BIDIRECTIONAL_SUBJECTS(FUNCTION); \
+  BENCHMARK_SUBJECT(FUNCTION, ForwardIteratorSubject)
+
+#define BENCHMARK_INPUT_SUBJECTS(FUNCTION) \
+  BENCHMARK_FORWARD_SUBJECTS(FUNCTION); \
+  BENCHMARK_SUBJECT(FUNCTION, InputIteratorSubject)
+
+BENCHMARK_INPUT_SUBJECTS(BM_Accumulate);
+BENCHMARK_INPUT_SUBJECTS(BM_Copy);
+BENCHMARK_INPUT_SUBJECTS(BM_Find);
+BENCHMARK_RANDOM_ACCESS_SUBJECTS(BM_LowerBound);
+BENCHMARK_BIDIRECTIONAL_SUBJECTS(BM_ReverseLoop);
+BENCHMARK_SUBJECT(BM_RangeForLoop, NativeReverseIteratorSubject);
+BENCHMARK_SUBJECT(BM_ReverseLoop, NativeReverseIteratorSubject);
+BENCHMARK_SUBJECT(BM_ReverseLoop, WrappedReverseIteratorSubject);
+BENCHMARK_FORWARD_SUBJECTS(BM_RangeForLoop);
+BENCHMARK_SUBJECT(BM_RangeForLoop, SentinelSubject);
+BENCHMARK_RANDOM_ACCESS_SUBJECTS(BM_Sort);
+
+#if __cplusplus >= 202002L
+BENCHMARK_CONTIGUOUS_SUBJECTS(BM_ContiguousCopy);
+#endif
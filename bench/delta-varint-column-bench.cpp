@@ -0,0 +1,127 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/delta-varint-column.hpp>
+#include "bench-support.hpp"
+
+// ****************************** Benchmark Subjects *********************************************
+// Sorted ids with random gaps of mean `MeanGap` (dense: one byte deltas, sparse: two byte deltas) stored in a
+// `std::vector<uint64_t>` (the baseline) and in a `delta_varint_column<>` (blocks of 128 delta varints).
+// `bytes_per_element` reports the memory of the container per id, `ints_per_ns` the decode throughput.
+
+template<std::uint64_t MeanGap>
+static std::vector<uint64_t> MakeSortedIds(size_t count) {
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<uint64_t> gap(1, 2 * MeanGap - 1);
+    std::vector<uint64_t> ids(count);
+    uint64_t id = 1000000;
+    for (uint64_t &current: ids) {
+        id += gap(random);
+        current = id;
+    }
+    return ids;
+}
+
+template<std::uint64_t MeanGap>
+struct VectorSubject {
+    std::vector<uint64_t> container;
+
+    explicit VectorSubject(size_t count): container(MakeSortedIds<MeanGap>(count)) {}
+
+    size_t size_bytes() const { return container.size() * sizeof(uint64_t); }
+    auto lower_bound(uint64_t value) const { return std::lower_bound(container.begin(), container.end(), value); }
+};
+
+template<std::uint64_t MeanGap>
+struct ColumnSubject {
+    tmc::foundation::delta_varint_column<> container;
+
+    explicit ColumnSubject(size_t count) {
+        const std::vector<uint64_t> ids = MakeSortedIds<MeanGap>(count);
+        container = tmc::foundation::delta_varint_column<>(ids.begin(), ids.end());
+        container.shrink_to_fit();
+    }
+
+    size_t size_bytes() const { return container.size_bytes(); }
+    auto lower_bound(uint64_t value) const { return container.lower_bound(value); }
+};
+
+typedef VectorSubject<8> DenseVectorSubject;
+typedef ColumnSubject<8> DenseColumnSubject;
+typedef VectorSubject<4096> SparseVectorSubject;
+typedef ColumnSubject<4096> SparseColumnSubject;
+
+static void ColumnCounts(benchmark::internal::Benchmark *benchmark) {
+    for (int64_t count = 10000; count <= 10000000; count *= 10) {
+        benchmark->Arg(count);
+    }
+}
+
+template<typename TSubject>
+static void SetColumnCounters(benchmark::State &state, const TSubject &subject, size_t count) {
+    const double bytesPerElement = static_cast<double>(subject.size_bytes()) / static_cast<double>(count);
+    SetElementCounters(state, count, bytesPerElement);
+    state.counters["bytes_per_element"] = bytesPerElement;
+    state.counters["ints_per_ns"] = benchmark::Counter(static_cast<double>(count) * 1e-9, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+
+// ****************************** Decode / Seek *********************************************
+
+template<typename TSubject>
+void BM_SortedScan(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const TSubject subject(count);
+
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (uint64_t id: subject.container) {
+            sum += id;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetColumnCounters(state, subject, count);
+}
+
+// 1000 lookups of random ids per iteration, `ns_per_element` is the time per lookup
+template<typename TSubject>
+void BM_SortedLowerBound(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const TSubject subject(count);
+    const uint64_t first = *subject.container.begin();
+    const uint64_t last = *std::max_element(subject.container.begin(), subject.container.end());
+
+    std::mt19937_64 random(7);
+    std::uniform_int_distribution<uint64_t> distribution(first, last);
+    std::vector<uint64_t> searched(1000);
+    for (uint64_t &value: searched) {
+        value = distribution(random);
+    }
+
+    for (auto _ : state) {
+        for (uint64_t value: searched) {
+            auto found = subject.lower_bound(value);
+            benchmark::DoNotOptimize(found);
+        }
+    }
+
+    SetElementCounters(state, searched.size(), 0);
+}
+
+
+// ****************************** Registration *********************************************
+
+#define BENCHMARK_COLUMN_SUBJECTS(FUNCTION) \
+  BENCHMARK_TEMPLATE(FUNCTION, DenseVectorSubject)->Apply(ColumnCounts); \
+  BENCHMARK_TEMPLATE(FUNCTION, DenseColumnSubject)->Apply(ColumnCounts); \
+  BENCHMARK_TEMPLATE(FUNCTION, SparseVectorSubject)->Apply(ColumnCounts); \
+  BENCHMARK_TEMPLATE(FUNCTION, SparseColumnSubject)->Apply(ColumnCounts)
+
+BENCHMARK_COLUMN_SUBJECTS(BM_SortedScan);
+BENCHMARK_COLUMN_SUBJECTS(BM_SortedLowerBound);
@@ -0,0 +1,120 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/fd-input-iterator.hpp>
+#include "bench-support.hpp"
+
+using tmc::foundation::fd_input_range;
+
+// ****************************** Streaming Input *********************************************
+// Counts the newlines of a file (page cache warm), opened in each iteration:
+// - istreambuf          : `std::istreambuf_iterator<char>` over a `std::ifstream`, the standard baseline
+// - fd static 64K       : `fd_input_range<char, 65536>`, buffer inside the range object
+// - fd dynamic 64K / 4K : `fd_input_range<char>` with a runtime buffer size
+// - fd chunked          : `fd_input_range<char, 65536>` consumed by `next_chunk()` batches (C++20)
+
+static std::string MakeTextFile(size_t size) {
+    const std::string path = "/tmp/tmc-fd-input-bench-" + std::to_string(size) + ".txt";
+    std::ifstream existing(path, std::ios::binary | std::ios::ate);
+    if (existing && static_cast<size_t>(existing.tellg()) == size) {
+        return path;
+    }
+
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    for (size_t index = 0; index < size; ++index) {
+        stream.put(index % 64 == 63 ? '\n' : static_cast<char>('a' + index % 26));
+    }
+    return path;
+}
+
+struct IStreamBufCount {
+    static int64_t count(const std::string &path) {
+        std::ifstream stream(path, std::ios::binary);
+        int64_t lines = 0;
+        for (std::istreambuf_iterator<char> it(stream), last; it != last; ++it) {
+            lines += *it == '\n';
+        }
+        return lines;
+    }
+};
+
+template<size_t BufferSize>
+struct FdStaticCount {
+    static int64_t count(const std::string &path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        int64_t lines = 0;
+        {
+            fd_input_range<char, BufferSize> input(fd);
+            for (char character: input) {
+                lines += character == '\n';
+            }
+        }
+        ::close(fd);
+        return lines;
+    }
+};
+
+template<size_t BufferSize>
+struct FdDynamicCount {
+    static int64_t count(const std::string &path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        int64_t lines = 0;
+        {
+            fd_input_range<char> input(fd, BufferSize);
+            for (char character: input) {
+                lines += character == '\n';
+            }
+        }
+        ::close(fd);
+        return lines;
+    }
+};
+
+#if __cplusplus >= 202002L
+struct FdChunkedCount {
+    static int64_t count(const std::string &path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        int64_t lines = 0;
+        {
+            fd_input_range<char, 65536> input(fd);
+            auto it = input.begin();
+            for (auto chunk = it.next_chunk(input.end(), 65536); !chunk.empty(); chunk = it.next_chunk(input.end(), 65536)) {
+                for (char character: chunk) {
+                    lines += character == '\n';
+                }
+            }
+        }
+        ::close(fd);
+        return lines;
+    }
+};
+#endif
+
+// File sizes 1 KB ... 100 MB
+template<typename TCount>
+void BM_FdInputLineCount(benchmark::State &state) {
+    const size_t size = static_cast<size_t>(state.range(0));
+    const std::string path = MakeTextFile(size);
+
+    for (auto _ : state) {
+        int64_t lines = TCount::count(path);
+        benchmark::DoNotOptimize(lines);
+    }
+
+    SetElementCounters(state, size, sizeof(char));
+}
+
+BENCHMARK_TEMPLATE(BM_FdInputLineCount, IStreamBufCount)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_FdInputLineCount, FdStaticCount<65536>)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_FdInputLineCount, FdDynamicCount<65536>)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_FdInputLineCount, FdDynamicCount<4096>)->Apply(ElementCounts);
+#if __cplusplus >= 202002L
+BENCHMARK_TEMPLATE(BM_FdInputLineCount, FdChunkedCount)->Apply(ElementCounts);
+#endif
@@ -0,0 +1,131 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/filter-transform-iterator.hpp>
+#include "bench-support.hpp"
+#include "custom-container-skeletons.hpp"
+
+// ****************************** Allocation Counting *********************************************
+// Allocator of the materializing vectors: counts their heap allocations, the pipeline benchmarks report them per run.
+// The other pipelines allocate no containers. (No global `operator new` replacement, it would slow down all benchmarks
+// of the executable.)
+
+static std::size_t pipelineAllocations = 0;
+
+template<typename T>
+struct CountingAllocator {
+    typedef T value_type;
+
+    CountingAllocator() = default;
+
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U> &) {}
+
+    T * allocate(std::size_t count) {
+        ++pipelineAllocations;
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T *memory, std::size_t count) { std::allocator<T>().deallocate(memory, count); }
+
+    template<typename U>
+    bool operator==(const CountingAllocator<U> &) const { return true; }
+
+    template<typename U>
+    bool operator!=(const CountingAllocator<U> &) const { return false; }
+};
+
+template<typename T>
+using counted_vector = std::vector<T, CountingAllocator<T>>;
+
+// ****************************** Filter / Transform Pipelines *********************************************
+// Sum over `filter(value % 3 != 0) | transform(value * value) | filter(square < 5000)` of a custom container
+// (random access custom iterator states), sizes 1K ... 10M elements:
+// - hand written loop : one loop with the stages inlined, the baseline
+// - materialize       : every stage copies its output into a `std::vector` (counting allocator), the next stage iterates it
+// - lazy adapters     : `make_filter_range` / `make_transform_range` fused into one adapter state
+
+typedef CustomContainerWithTrivialIteratorState PipelineContainer;
+
+static void PipelineCounts(benchmark::internal::Benchmark *benchmark) {
+    for (int64_t count = 1000; count <= 10000000; count *= 10) {
+        benchmark->Arg(count);
+    }
+}
+
+static PipelineContainer MakePipelineContainer(size_t count) {
+    PipelineContainer container;
+    container.InternalData.resize(count);
+    for (size_t index = 0; index < count; ++index) {
+        container.InternalData[index].SetValue(static_cast<int>((index * 7) % 100));
+    }
+    return container;
+}
+
+inline bool IsNotMultipleOf3(int value) { return value % 3 != 0; }
+inline int64_t Square(int value) { return static_cast<int64_t>(value) * value; }
+inline bool IsBelow5000(int64_t square) { return square < 5000; }
+
+struct HandWrittenLoopPipeline {
+    static int64_t sum(const PipelineContainer &container) {
+        int64_t sum = 0;
+        for (const CustomElement &element: container.InternalData) {
+            if (IsNotMultipleOf3(element.GetValue())) {
+                const int64_t square = Square(element.GetValue());
+                if (IsBelow5000(square)) {
+                    sum += square;
+                }
+            }
+        }
+        return sum;
+    }
+};
+
+struct MaterializePipeline {
+    static int64_t sum(const PipelineContainer &container) {
+        counted_vector<CustomElement> filtered;
+        std::copy_if(container.begin(), container.end(), std::back_inserter(filtered), [](const CustomElement &element) { return IsNotMultipleOf3(element.GetValue()); });
+        counted_vector<int64_t> squares;
+        std::transform(filtered.begin(), filtered.end(), std::back_inserter(squares), [](const CustomElement &element) { return Square(element.GetValue()); });
+        counted_vector<int64_t> small;
+        std::copy_if(squares.begin(), squares.end(), std::back_inserter(small), IsBelow5000);
+        return std::accumulate(small.begin(), small.end(), int64_t{0});
+    }
+};
+
+struct LazyAdapterPipeline {
+    static int64_t sum(const PipelineContainer &container) {
+        using namespace tmc::foundation;
+        auto filtered = make_filter_range(container, [](const CustomElement &element) { return IsNotMultipleOf3(element.GetValue()); });
+        auto squares = make_transform_range(filtered, [](const CustomElement &element) { return Square(element.GetValue()); });
+        auto small = make_filter_range(squares, IsBelow5000);
+        return std::accumulate(small.begin(), small.end(), int64_t{0});
+    }
+};
+
+template<typename TPipeline>
+void BM_FilterTransformPipeline(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const PipelineContainer container = MakePipelineContainer(count);
+
+    const std::size_t allocations = pipelineAllocations;
+    for (auto _ : state) {
+        int64_t sum = TPipeline::sum(container);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.counters["allocations"] = benchmark::Counter(static_cast<double>(pipelineAllocations - allocations), benchmark::Counter::kAvgIterations);
+    SetElementCounters(state, count, sizeof(CustomElement));
+}
+
+BENCHMARK_TEMPLATE(BM_FilterTransformPipeline, HandWrittenLoopPipeline)->Apply(PipelineCounts);
+BENCHMARK_TEMPLATE(BM_FilterTransformPipeline, MaterializePipeline)->Apply(PipelineCounts);
+BENCHMARK_TEMPLATE(BM_FilterTransformPipeline, LazyAdapterPipeline)->Apply(PipelineCounts);
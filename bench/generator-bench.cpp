@@ -0,0 +1,135 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#if __cplusplus >= 202002L
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/generator.hpp>
+#include <tmc/foundation/custom-iterator-template-helper.hpp>
+#include "bench-support.hpp"
+
+using tmc::foundation::generator;
+
+// ****************************** Lazy Producers *********************************************
+// Sums the values `0 ... count - 1` of a lazy producer:
+// - hand written state : counting range with a `custom_iterator_template` input state, the baseline
+// - generator          : `generator<int64_t>` coroutine, frames from the thread local frame pool
+// - callback           : producer pushing each value into a `std::function` sink
+// The setup benchmark creates and drains short generators (8 values) to show the cost of a pooled frame.
+
+class CountingRange {
+    public:
+    explicit CountingRange(int64_t count): count_(count) {}
+
+    template<bool is_const>
+    struct iterator_state {
+        typedef std::input_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CountingRange, CountingRange>::type container_type;
+        typedef const int64_t value_type;
+
+        static constexpr bool compares_unconnected = true;
+
+        container_type * container_{nullptr};
+        int64_t current_{0};
+
+        inline iterator_state() = default;
+        inline iterator_state(container_type * container): container_(container) {}
+
+        inline void begin() { current_ = 0; }
+        inline void end() { current_ = container_->count_; }
+
+        inline bool is_connected() const { return container_ != nullptr; }
+
+        template<bool other_is_const>
+        inline bool is_equal(const iterator_state<other_is_const> & other) const { return current_ == other.current_; }
+
+        inline void next() { ++current_; }
+        inline value_type & get() const { return current_; }
+    };
+
+    SETUP_RANGE_ITERATORS(iterator_state);
+
+    private:
+    int64_t count_;
+};
+
+static generator<int64_t> CountGenerator(int64_t count) {
+    for (int64_t value = 0; value < count; ++value) {
+        co_yield value;
+    }
+}
+
+static void CountCallback(int64_t count, const std::function<void(int64_t)> &sink) {
+    for (int64_t value = 0; value < count; ++value) {
+        sink(value);
+    }
+}
+
+struct HandWrittenProducer {
+    static int64_t sum(int64_t count) {
+        int64_t sum = 0;
+        for (int64_t value: CountingRange(count)) {
+            sum += value;
+        }
+        return sum;
+    }
+};
+
+struct GeneratorProducer {
+    static int64_t sum(int64_t count) {
+        int64_t sum = 0;
+        for (int64_t value: CountGenerator(count)) {
+            sum += value;
+        }
+        return sum;
+    }
+};
+
+struct CallbackProducer {
+    static int64_t sum(int64_t count) {
+        int64_t sum = 0;
+        CountCallback(count, [&sum](int64_t value) { sum += value; });
+        return sum;
+    }
+};
+
+template<typename TProducer>
+void BM_LazyProducer(benchmark::State &state) {
+    const int64_t count = state.range(0);
+
+    for (auto _ : state) {
+        int64_t sum = TProducer::sum(count);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, static_cast<size_t>(count), sizeof(int64_t));
+}
+
+// 1000 generators of 8 values per iteration, `heap_frames` counts the frames not served by the pool
+template<typename TProducer>
+void BM_LazyProducerSetup(benchmark::State &state) {
+    const std::size_t heapAllocations = tmc::foundation::detail::frame_pool::heap_allocations();
+
+    for (auto _ : state) {
+        for (int round = 0; round < 1000; ++round) {
+            int64_t sum = TProducer::sum(8);
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+
+    state.counters["heap_frames"] = static_cast<double>(tmc::foundation::detail::frame_pool::heap_allocations() - heapAllocations);
+    SetElementCounters(state, 8000, sizeof(int64_t));
+}
+
+BENCHMARK_TEMPLATE(BM_LazyProducer, HandWrittenProducer)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_LazyProducer, GeneratorProducer)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_LazyProducer, CallbackProducer)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_LazyProducerSetup, HandWrittenProducer);
+BENCHMARK_TEMPLATE(BM_LazyProducerSetup, GeneratorProducer);
+BENCHMARK_TEMPLATE(BM_LazyProducerSetup, CallbackProducer);
+
+#endif
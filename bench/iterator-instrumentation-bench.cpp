@@ -0,0 +1,78 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <cstdint>
+#include <iterator>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/iterator-instrumentation.hpp>
+#include "bench-support.hpp"
+#include "custom-container-skeletons.hpp"
+
+// ****************************** Iterator Instrumentation *********************************************
+// Summing loops over the trivial skeleton state, sizes 1K ... 10M elements:
+// - uninstrumented : `no_instrumentation`, the default
+// - counting       : `counting_instrumentation`, one relaxed increment of a thread owned counter per operation
+// Forward, post-increment and `std::reverse_iterator` loops report the counted copies per element (`copies_per_element`)
+
+using tmc::foundation::counting_instrumentation;
+using tmc::foundation::custom_iterator_template;
+using tmc::foundation::default_iterator_policy;
+using tmc::foundation::iterator_operation;
+using tmc::foundation::no_instrumentation;
+
+enum class LoopKind { prefix, postfix, reverse };
+
+// Sizes 1K ... 10M elements
+static void InstrumentedElementCounts(benchmark::internal::Benchmark *benchmark) {
+    for (int64_t count: {1000, 10000, 100000, 1000000, 10000000}) {
+        benchmark->Arg(count);
+    }
+}
+
+template<typename TIterator, LoopKind kind>
+static int64_t Sum(TIterator first, TIterator last) {
+    int64_t sum = 0;
+    if constexpr (kind == LoopKind::prefix) {
+        for (; first != last; ++first) {
+            sum += first->GetValue();
+        }
+    } else if constexpr (kind == LoopKind::postfix) {
+        while (first != last) {
+            sum += (*first++).GetValue();
+        }
+    } else {
+        for (std::reverse_iterator<TIterator> current(last), end(first); current != end; ++current) {
+            sum += current->GetValue();
+        }
+    }
+    return sum;
+}
+
+template<typename TInstrumentation, LoopKind kind>
+void BM_InstrumentedIteration(benchmark::State &state) {
+    typedef custom_iterator_template<CustomContainerWithTrivialIteratorState::iterator_state, true, default_iterator_policy, TInstrumentation> iterator;
+
+    const size_t count = static_cast<size_t>(state.range(0));
+    CustomContainerWithTrivialIteratorState container;
+    container.InternalData.resize(count);
+    if constexpr (TInstrumentation::enabled) {
+        counting_instrumentation::reset<iterator>();
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Sum<iterator, kind>(iterator::begin(&container), iterator::end(&container)));
+    }
+
+    SetElementCounters(state, count, sizeof(CustomElement));
+    if constexpr (TInstrumentation::enabled) {
+        const double copies = static_cast<double>(counting_instrumentation::counts<iterator>()[iterator_operation::copy]);
+        state.counters["copies_per_element"] = copies / static_cast<double>(state.iterations() * count);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_InstrumentedIteration, no_instrumentation, LoopKind::prefix)->Apply(InstrumentedElementCounts);
+BENCHMARK_TEMPLATE(BM_InstrumentedIteration, counting_instrumentation, LoopKind::prefix)->Apply(InstrumentedElementCounts);
+BENCHMARK_TEMPLATE(BM_InstrumentedIteration, no_instrumentation, LoopKind::postfix)->Apply(InstrumentedElementCounts);
+BENCHMARK_TEMPLATE(BM_InstrumentedIteration, counting_instrumentation, LoopKind::postfix)->Apply(InstrumentedElementCounts);
+BENCHMARK_TEMPLATE(BM_InstrumentedIteration, no_instrumentation, LoopKind::reverse)->Apply(InstrumentedElementCounts);
+BENCHMARK_TEMPLATE(BM_InstrumentedIteration, counting_instrumentation, LoopKind::reverse)->Apply(InstrumentedElementCounts);
@@ -0,0 +1,143 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/mapped-record-file.hpp>
+#include "bench-support.hpp"
+
+using tmc::foundation::access_hint;
+using tmc::foundation::mapped_record_file;
+
+// ****************************** Record Files *********************************************
+// Fixed size records in a file, opened and scanned:
+// - read into vector     : `std::ifstream::read()` of the whole file into a `std::vector`, then scanned
+// - mapped               : `mapped_record_file` with sequential access hint, records read in place
+// - mapped huge pages    : as mapped, at a huge page aligned address
+// Startup measures open + access of the first record, scan measures open + sum of all records.
+// Cold runs drop the file from the page cache before each iteration (`posix_fadvise(POSIX_FADV_DONTNEED)`).
+
+struct FileRecord {
+    int64_t key;
+    int64_t value;
+    double payload[2];
+};
+
+static std::string RecordFilePath(size_t count) {
+    return "/tmp/tmc-record-file-bench-" + std::to_string(count) + ".bin";
+}
+
+// Creates the record file once per size - the files are kept for repeated runs
+static std::string MakeRecordFile(size_t count) {
+    const std::string path = RecordFilePath(count);
+    std::ifstream existing(path, std::ios::binary | std::ios::ate);
+    if (existing && static_cast<size_t>(existing.tellg()) == count * sizeof(FileRecord)) {
+        return path;
+    }
+
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    std::vector<FileRecord> block(4096);
+    for (size_t written = 0; written < count; written += block.size()) {
+        const size_t blockCount = std::min(block.size(), count - written);
+        for (size_t index = 0; index < blockCount; ++index) {
+            block[index] = FileRecord{static_cast<int64_t>(written + index), static_cast<int64_t>((written + index) % 1000), {0.0, 0.0}};
+        }
+        stream.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(blockCount * sizeof(FileRecord)));
+    }
+    return path;
+}
+
+static void DropFromPageCache(const std::string &path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+}
+
+struct ReadIntoVector {
+    static std::vector<FileRecord> open(const std::string &path) {
+        std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        std::vector<FileRecord> records(static_cast<size_t>(stream.tellg()) / sizeof(FileRecord));
+        stream.seekg(0);
+        stream.read(reinterpret_cast<char *>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(FileRecord)));
+        return records;
+    }
+};
+
+struct Mapped {
+    static mapped_record_file<FileRecord> open(const std::string &path) { return mapped_record_file<FileRecord>(path, access_hint::sequential); }
+};
+
+struct MappedHugePages {
+    static mapped_record_file<FileRecord> open(const std::string &path) { return mapped_record_file<FileRecord>(path, access_hint::sequential, true); }
+};
+
+template<typename TRecords>
+static int64_t SumValues(const TRecords &records) {
+    int64_t sum = 0;
+    for (const FileRecord &record: records) {
+        sum += record.value;
+    }
+    return sum;
+}
+
+// Element counts 1K ... 10M (320 MB)
+static void RecordCounts(benchmark::internal::Benchmark *benchmark) {
+    for (int64_t count = 1000; count <= 10000000; count *= 10) {
+        benchmark->Arg(count);
+    }
+}
+
+template<typename TOpen, bool cold>
+void BM_RecordFileStartup(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const std::string path = MakeRecordFile(count);
+
+    for (auto _ : state) {
+        if (cold) {
+            state.PauseTiming();
+            DropFromPageCache(path);
+            state.ResumeTiming();
+        }
+        const auto records = TOpen::open(path);
+        int64_t key = records.begin()->key;
+        benchmark::DoNotOptimize(key);
+    }
+}
+
+template<typename TOpen, bool cold>
+void BM_RecordFileScan(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const std::string path = MakeRecordFile(count);
+
+    for (auto _ : state) {
+        if (cold) {
+            state.PauseTiming();
+            DropFromPageCache(path);
+            state.ResumeTiming();
+        }
+        const auto records = TOpen::open(path);
+        int64_t sum = SumValues(records);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, count, sizeof(FileRecord));
+}
+
+BENCHMARK_TEMPLATE(BM_RecordFileStartup, ReadIntoVector, true)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_RecordFileStartup, Mapped, true)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_RecordFileStartup, MappedHugePages, true)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_RecordFileScan, ReadIntoVector, true)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_RecordFileScan, Mapped, true)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_RecordFileScan, MappedHugePages, true)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_RecordFileScan, ReadIntoVector, false)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_RecordFileScan, Mapped, false)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_RecordFileScan, MappedHugePages, false)->Apply(RecordCounts);
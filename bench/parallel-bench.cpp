@@ -0,0 +1,89 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/parallel.hpp>
+#include "bench-support.hpp"
+#include "custom-container-skeletons.hpp"
+
+// ****************************** Parallel Scaling *********************************************
+// Runs the parallel algorithms over the random access test container (trivial state) with 1 ... N threads
+
+static CustomContainerWithTrivialIteratorState MakeParallelContainer(size_t count) {
+    CustomContainerWithTrivialIteratorState container;
+    container.InternalData.reserve(count);
+    for (size_t index = 0; index < count; ++index) {
+        container.InternalData.push_back(CustomElement(static_cast<int>(index)));
+    }
+    return container;
+}
+
+// Element counts 100K ... 10M, thread counts 1, 2, 4, ... up to the hardware threads
+static void ParallelArguments(benchmark::internal::Benchmark *benchmark) {
+    const int64_t hardwareThreads = std::max<int64_t>(std::thread::hardware_concurrency(), 1);
+    for (int64_t count = 100000; count <= 10000000; count *= 10) {
+        for (int64_t threads = 1; threads < hardwareThreads * 2; threads *= 2) {
+            benchmark->Args({count, std::min(threads, hardwareThreads)});
+        }
+    }
+    benchmark->ArgNames({"elements", "threads"})->UseRealTime();
+}
+
+static void BM_ParallelForEach(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    tmc::foundation::thread_pool pool(static_cast<size_t>(state.range(1)));
+    auto container = MakeParallelContainer(count);
+
+    for (auto _ : state) {
+        tmc::foundation::parallel_for_each(pool, container.begin(), container.end(), [](CustomElement &element) {
+            element.SetValue(static_cast<int>(std::sqrt(static_cast<double>(element.GetValue())) * 16.0));
+        });
+        benchmark::ClobberMemory();
+    }
+
+    SetElementCounters(state, count, sizeof(CustomElement));
+}
+
+static void BM_ParallelTransformReduce(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    tmc::foundation::thread_pool pool(static_cast<size_t>(state.range(1)));
+    auto container = MakeParallelContainer(count);
+
+    for (auto _ : state) {
+        int64_t sum = tmc::foundation::parallel_transform_reduce(pool, container.cbegin(), container.cend(), int64_t{0}, std::plus<>(),
+            [](const CustomElement &element) { return static_cast<int64_t>(element.GetValue()); });
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, count, sizeof(CustomElement));
+}
+
+static void BM_ParallelSort(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    tmc::foundation::thread_pool pool(static_cast<size_t>(state.range(1)));
+    auto container = MakeParallelContainer(count);
+    auto shuffled = container.InternalData;
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(42));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy(shuffled.begin(), shuffled.end(), container.InternalData.begin());
+        state.ResumeTiming();
+
+        tmc::foundation::parallel_sort(pool, container.begin(), container.end(),
+            [](const CustomElement &lhs, const CustomElement &rhs) { return lhs.GetValue() < rhs.GetValue(); });
+        benchmark::ClobberMemory();
+    }
+
+    SetElementCounters(state, count, sizeof(CustomElement));
+}
+
+BENCHMARK(BM_ParallelForEach)->Apply(ParallelArguments);
+BENCHMARK(BM_ParallelTransformReduce)->Apply(ParallelArguments);
+BENCHMARK(BM_ParallelSort)->Apply(ParallelArguments);
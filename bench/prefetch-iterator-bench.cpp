@@ -0,0 +1,156 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/custom-iterator-template-helper.hpp>
+#include <tmc/foundation/prefetch-iterator.hpp>
+#include "bench-support.hpp"
+#include "linked-node-list.hpp"
+
+// ****************************** Prefetching Iterators *********************************************
+// Hashes the records of pointer chasing containers with nodes in random memory order, sizes up to 10M records
+// (640 MB of nodes, far beyond the last level cache):
+// - linked list        : `LinkedNodeList` without / with `prefetch_state` lookahead of 4 and 16 nodes
+// - pointer table      : random access state over a table of record pointers (hash buckets, indexes),
+//                        without / with `prefetch_state` prefetching `at(4)` / `at(16)`
+
+struct PrefetchRecord {
+    int64_t key;
+    int64_t values[6];
+};
+
+// Sizes 1K ... 10M records, 0 / 16 rounds of work per record
+static void RecordCounts(benchmark::internal::Benchmark *benchmark) {
+    for (int64_t count: {1000, 10000, 100000, 1000000, 10000000}) {
+        for (int64_t rounds: {0, 16}) {
+            benchmark->Args({count, rounds});
+        }
+    }
+    benchmark->ArgNames({"records", "work"});
+}
+
+// Dependent computation per record - fills the out of order window, which then cannot run ahead to the next misses
+static inline int64_t Work(int64_t sum, const PrefetchRecord &record, int rounds) {
+    uint64_t hash = static_cast<uint64_t>(record.key);
+    for (int round = 0; round < rounds; ++round) {
+        hash = (hash ^ (hash >> 29)) * 0xbf58476d1ce4e5b9ull;
+    }
+    return sum + static_cast<int64_t>(hash) + record.values[5];
+}
+
+template<std::size_t Distance>
+void BM_PrefetchLinkedList(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const int rounds = static_cast<int>(state.range(1));
+    LinkedNodeList<PrefetchRecord, Distance> list;
+    for (size_t index = 0; index < count; ++index) {
+        list.push_back(PrefetchRecord{static_cast<int64_t>(index), {1, 2, 3, 4, 5, 6}});
+    }
+    list.shuffle_nodes(42);
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (const PrefetchRecord &record: list) {
+            sum = Work(sum, record, rounds);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, count, sizeof(PrefetchRecord));
+}
+
+// Random access container of record pointers - each element access is a dependent load
+class PointerTable {
+    public:
+    explicit PointerTable(size_t count): records_(count) {
+        for (size_t index = 0; index < count; ++index) {
+            records_[index] = std::make_unique<PrefetchRecord>(PrefetchRecord{static_cast<int64_t>(index), {1, 2, 3, 4, 5, 6}});
+        }
+        std::shuffle(records_.begin(), records_.end(), std::mt19937(42));
+    }
+
+    template<bool is_const>
+    struct iterator_state {
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const PointerTable, PointerTable>::type container_type;
+        typedef typename std::conditional<is_const, const PrefetchRecord, PrefetchRecord>::type value_type;
+
+        static constexpr bool compares_unconnected = true;
+
+        container_type * container_{nullptr};
+        const std::unique_ptr<PrefetchRecord> * current_{nullptr};
+
+        inline iterator_state() = default;
+        inline iterator_state(container_type * container): container_(container) {}
+
+        template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+        inline iterator_state(const iterator_state<other_is_const> & source): container_(source.container_), current_(source.current_) {}
+
+        inline void begin() { current_ = container_->records_.data(); }
+        inline void end() { current_ = container_->records_.data() + container_->records_.size(); }
+
+        inline bool is_connected() const { return container_ != nullptr; }
+
+        template<bool other_is_const>
+        inline bool is_equal(const iterator_state<other_is_const> & other) const { return current_ == other.current_; }
+
+        inline void next() { ++current_; }
+        inline value_type & get() const { return **current_; }
+        inline void prev() { --current_; }
+        inline void move(std::ptrdiff_t offset) { current_ += offset; }
+
+        template<bool other_is_const>
+        inline std::ptrdiff_t distance(const iterator_state<other_is_const> & rhs) const { return current_ - rhs.current_; }
+
+        inline value_type & at(std::ptrdiff_t offset) const { return *current_[offset]; }
+    };
+
+    private:
+    std::vector<std::unique_ptr<PrefetchRecord>> records_;
+};
+
+template<std::size_t Distance>
+struct PointerTableState {
+    template<bool is_const>
+    using type = tmc::foundation::prefetch_state<PointerTable::iterator_state, Distance, is_const>;
+};
+
+template<>
+struct PointerTableState<0> {
+    template<bool is_const>
+    using type = PointerTable::iterator_state<is_const>;
+};
+
+template<std::size_t Distance>
+void BM_PrefetchPointerTable(benchmark::State &state) {
+    typedef tmc::foundation::custom_iterator_template<PointerTableState<Distance>::template type, true> iterator;
+
+    const size_t count = static_cast<size_t>(state.range(0));
+    const int rounds = static_cast<int>(state.range(1));
+    const PointerTable table(count);
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (auto it = iterator::begin(&table), last = iterator::end(&table); it != last; ++it) {
+            sum = Work(sum, *it, rounds);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, count, sizeof(PrefetchRecord));
+}
+
+BENCHMARK_TEMPLATE(BM_PrefetchLinkedList, 0)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_PrefetchLinkedList, 4)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_PrefetchLinkedList, 16)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_PrefetchPointerTable, 0)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_PrefetchPointerTable, 4)->Apply(RecordCounts);
+BENCHMARK_TEMPLATE(BM_PrefetchPointerTable, 16)->Apply(RecordCounts);
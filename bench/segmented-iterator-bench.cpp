@@ -0,0 +1,141 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/algorithms.hpp>
+#include "bench-support.hpp"
+#include "block-container.hpp"
+
+// ****************************** Benchmark Subjects *********************************************
+// Compares the `std` algorithms (block boundary check in every `operator++`) with the segment aware
+// `tmc::foundation` algorithms (tight loop per block) on the `BlockContainer` sample
+
+struct StdAlgorithms {
+    template<typename TIterator, typename T>
+    static T accumulate(TIterator first, TIterator last, T init) { return std::accumulate(first, last, init); }
+
+    template<typename TIterator, typename TOutputIterator>
+    static TOutputIterator copy(TIterator first, TIterator last, TOutputIterator result) { return std::copy(first, last, result); }
+
+    template<typename TIterator, typename T>
+    static void fill(TIterator first, TIterator last, const T &value) { std::fill(first, last, value); }
+
+    template<typename TIterator, typename T>
+    static TIterator find(TIterator first, TIterator last, const T &value) { return std::find(first, last, value); }
+};
+
+struct SegmentAwareAlgorithms {
+    template<typename TIterator, typename T>
+    static T accumulate(TIterator first, TIterator last, T init) { return tmc::foundation::accumulate(first, last, init); }
+
+    template<typename TIterator, typename TOutputIterator>
+    static TOutputIterator copy(TIterator first, TIterator last, TOutputIterator result) { return tmc::foundation::copy(first, last, result); }
+
+    template<typename TIterator, typename T>
+    static void fill(TIterator first, TIterator last, const T &value) { tmc::foundation::fill(first, last, value); }
+
+    template<typename TIterator, typename T>
+    static TIterator find(TIterator first, TIterator last, const T &value) { return tmc::foundation::find(first, last, value); }
+};
+
+// Baseline: `std::vector<int64_t>`
+struct VectorSubject {
+    typedef StdAlgorithms algorithms;
+    std::vector<int64_t> container;
+
+    explicit VectorSubject(size_t count) {
+        container.reserve(count);
+        for (size_t index = 0; index < count; ++index) {
+            container.push_back(static_cast<int64_t>(index));
+        }
+    }
+};
+
+template<typename TAlgorithms>
+struct BlockContainerSubject {
+    typedef TAlgorithms algorithms;
+    BlockContainer<int64_t> container;
+
+    explicit BlockContainerSubject(size_t count) {
+        for (size_t index = 0; index < count; ++index) {
+            container.push_back(static_cast<int64_t>(index));
+        }
+    }
+};
+
+typedef BlockContainerSubject<StdAlgorithms> BlockContainerStdSubject;
+typedef BlockContainerSubject<SegmentAwareAlgorithms> BlockContainerSegmentedSubject;
+
+
+// ****************************** Algorithms *********************************************
+
+template<typename TSubject>
+void BM_SegmentedAccumulate(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    TSubject subject(count);
+
+    for (auto _ : state) {
+        int64_t sum = TSubject::algorithms::accumulate(subject.container.begin(), subject.container.end(), int64_t{0});
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, count, sizeof(int64_t));
+}
+
+template<typename TSubject>
+void BM_SegmentedCopy(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    TSubject subject(count);
+    std::vector<int64_t> target(count);
+
+    for (auto _ : state) {
+        TSubject::algorithms::copy(subject.container.begin(), subject.container.end(), target.data());
+        benchmark::ClobberMemory();
+    }
+
+    SetElementCounters(state, count, 2 * sizeof(int64_t));
+}
+
+template<typename TSubject>
+void BM_SegmentedFill(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    TSubject subject(count);
+
+    for (auto _ : state) {
+        TSubject::algorithms::fill(subject.container.begin(), subject.container.end(), int64_t{42});
+        benchmark::ClobberMemory();
+    }
+
+    SetElementCounters(state, count, sizeof(int64_t));
+}
+
+template<typename TSubject>
+void BM_SegmentedFind(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    TSubject subject(count);
+    const int64_t needle = static_cast<int64_t>(count) - 1;
+
+    for (auto _ : state) {
+        auto found = TSubject::algorithms::find(subject.container.begin(), subject.container.end(), needle);
+        benchmark::DoNotOptimize(found);
+    }
+
+    SetElementCounters(state, count, sizeof(int64_t));
+}
+
+
+// ****************************** Registration *********************************************
+
+#define BENCHMARK_SEGMENTED_SUBJECTS(FUNCTION) \
+  BENCHMARK_TEMPLATE(FUNCTION, VectorSubject)->Apply(ElementCounts); \
+  BENCHMARK_TEMPLATE(FUNCTION, BlockContainerStdSubject)->Apply(ElementCounts); \
+  BENCHMARK_TEMPLATE(FUNCTION, BlockContainerSegmentedSubject)->Apply(ElementCounts)
+
+BENCHMARK_SEGMENTED_SUBJECTS(BM_SegmentedAccumulate);
+BENCHMARK_SEGMENTED_SUBJECTS(BM_SegmentedCopy);
+BENCHMARK_SEGMENTED_SUBJECTS(BM_SegmentedFill);
+BENCHMARK_SEGMENTED_SUBJECTS(BM_SegmentedFind);
@@ -0,0 +1,107 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "bench-support.hpp"
+#include "soa-container.hpp"
+
+// ****************************** Struct of Arrays vs. Array of Structs *********************************************
+// - AoS          : `std::vector<SoAElement>`, a scan of one member loads the whole struct
+// - SoA proxy    : `SoAContainer` iterators returning `SoAReference` proxies
+// - SoA column   : direct loop over the column vector, the ideal of the SoA layout
+
+struct AoSSubject {
+    std::vector<SoAElement> elements;
+
+    explicit AoSSubject(const std::vector<SoAElement> &source): elements(source) {}
+    void assign(const std::vector<SoAElement> &source) { std::copy(source.begin(), source.end(), elements.begin()); }
+
+    double sum() const {
+        double sum = 0.0;
+        for (auto it = elements.begin(); it != elements.end(); ++it) {
+            sum += it->value;
+        }
+        return sum;
+    }
+
+    void sort() { std::sort(elements.begin(), elements.end(), [](const auto &lhs, const auto &rhs) { return lhs.key < rhs.key; }); }
+};
+
+struct SoAProxySubject {
+    SoAContainer container;
+
+    explicit SoAProxySubject(const std::vector<SoAElement> &source) {
+        for (const auto &element: source) {
+            container.push_back(element);
+        }
+    }
+
+    void assign(const std::vector<SoAElement> &source) { std::copy(source.begin(), source.end(), container.begin()); }
+
+    double sum() const {
+        double sum = 0.0;
+        for (auto it = container.cbegin(); it != container.cend(); ++it) {
+            sum += it->value;
+        }
+        return sum;
+    }
+
+    void sort() { std::sort(container.begin(), container.end(), [](const auto &lhs, const auto &rhs) { return lhs.key < rhs.key; }); }
+};
+
+struct SoAColumnSubject: SoAProxySubject {
+    using SoAProxySubject::SoAProxySubject;
+
+    double sum() const { return std::accumulate(container.values().begin(), container.values().end(), 0.0); }
+};
+
+static std::vector<SoAElement> MakeSoAElements(size_t count) {
+    std::vector<SoAElement> elements(count);
+    for (size_t index = 0; index < count; ++index) {
+        elements[index] = SoAElement{static_cast<int64_t>(index), index * 0.5, 1.0};
+    }
+    std::shuffle(elements.begin(), elements.end(), std::mt19937(42));
+    return elements;
+}
+
+template<typename TSubject>
+void BM_SoAFieldScan(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const TSubject subject(MakeSoAElements(count));
+
+    for (auto _ : state) {
+        double sum = subject.sum();
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, count, sizeof(double));
+}
+
+template<typename TSubject>
+void BM_SoASort(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const std::vector<SoAElement> shuffled = MakeSoAElements(count);
+    TSubject subject(shuffled);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        subject.assign(shuffled);
+        state.ResumeTiming();
+
+        subject.sort();
+        benchmark::ClobberMemory();
+    }
+
+    SetElementCounters(state, count, sizeof(SoAElement));
+}
+
+BENCHMARK_TEMPLATE(BM_SoAFieldScan, AoSSubject)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_SoAFieldScan, SoAProxySubject)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_SoAFieldScan, SoAColumnSubject)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_SoASort, AoSSubject)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_SoASort, SoAProxySubject)->Apply(ElementCounts);
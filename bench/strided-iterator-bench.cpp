@@ -0,0 +1,108 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/strided-iterator.hpp>
+#include "bench-support.hpp"
+
+// ****************************** Field Scans *********************************************
+// Sums one field of an array of structs `passes` times:
+// - pointer loop        : hand written loop over the structs, the baseline
+// - static / dynamic    : `strided_range` with compile time / runtime stride
+// - gathered column     : copies the field into a temporary vector once, then scans the contiguous column
+// Gathering pays off when the field is scanned several times: one strided pass plus contiguous passes
+
+struct ScanRecord {
+    int64_t key;
+    int32_t value;
+    int32_t flags;
+    double payload[2];
+};
+
+static std::vector<ScanRecord> MakeScanRecords(size_t count) {
+    std::vector<ScanRecord> records(count);
+    for (size_t index = 0; index < count; ++index) {
+        records[index].key = static_cast<int64_t>(index);
+        records[index].value = static_cast<int32_t>(index % 1000);
+    }
+    return records;
+}
+
+struct PointerLoopScan {
+    static int64_t scan(const std::vector<ScanRecord> &records, int passes) {
+        int64_t sum = 0;
+        for (int pass = 0; pass < passes; ++pass) {
+            const ScanRecord *last = records.data() + records.size();
+            for (const ScanRecord *record = records.data(); record != last; ++record) {
+                sum += record->value;
+            }
+        }
+        return sum;
+    }
+};
+
+struct StaticStrideScan {
+    static int64_t scan(const std::vector<ScanRecord> &records, int passes) {
+        const auto values = tmc::foundation::make_field_range(records.data(), records.size(), &ScanRecord::value);
+        int64_t sum = 0;
+        for (int pass = 0; pass < passes; ++pass) {
+            sum = std::accumulate(values.begin(), values.end(), sum);
+        }
+        return sum;
+    }
+};
+
+struct DynamicStrideScan {
+    static int64_t scan(const std::vector<ScanRecord> &records, int passes) {
+        const tmc::foundation::strided_range<const int32_t> values(&records.data()->value, records.size(), sizeof(ScanRecord));
+        int64_t sum = 0;
+        for (int pass = 0; pass < passes; ++pass) {
+            sum = std::accumulate(values.begin(), values.end(), sum);
+        }
+        return sum;
+    }
+};
+
+struct GatheredColumnScan {
+    static int64_t scan(const std::vector<ScanRecord> &records, int passes) {
+        const auto values = tmc::foundation::make_field_range(records.data(), records.size(), &ScanRecord::value);
+        const std::vector<int32_t> column(values.begin(), values.end());
+        int64_t sum = 0;
+        for (int pass = 0; pass < passes; ++pass) {
+            sum = std::accumulate(column.begin(), column.end(), sum);
+        }
+        return sum;
+    }
+};
+
+// Element counts 1K ... 10M, 1 / 4 / 16 passes
+static void FieldScanArguments(benchmark::internal::Benchmark *benchmark) {
+    for (int64_t count = 1000; count <= 10000000; count *= 10) {
+        for (int64_t passes: {1, 4, 16}) {
+            benchmark->Args({count, passes});
+        }
+    }
+    benchmark->ArgNames({"elements", "passes"});
+}
+
+template<typename TScan>
+void BM_FieldScan(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const int passes = static_cast<int>(state.range(1));
+    const std::vector<ScanRecord> records = MakeScanRecords(count);
+
+    for (auto _ : state) {
+        int64_t sum = TScan::scan(records, passes);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, count * static_cast<size_t>(passes), sizeof(int32_t));
+}
+
+BENCHMARK_TEMPLATE(BM_FieldScan, PointerLoopScan)->Apply(FieldScanArguments);
+BENCHMARK_TEMPLATE(BM_FieldScan, StaticStrideScan)->Apply(FieldScanArguments);
+BENCHMARK_TEMPLATE(BM_FieldScan, DynamicStrideScan)->Apply(FieldScanArguments);
+BENCHMARK_TEMPLATE(BM_FieldScan, GatheredColumnScan)->Apply(FieldScanArguments);
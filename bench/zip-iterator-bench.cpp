@@ -0,0 +1,144 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <cstdint>
+#include <tuple>
+#include <benchmark/benchmark.h>
+#include <tmc/foundation/zip-iterator.hpp>
+#include "bench-support.hpp"
+#include "custom-container-skeletons.hpp"
+
+using tmc::foundation::make_zip_range;
+
+// ****************************** Lockstep Kernels *********************************************
+// Walks 2 / 4 parallel containers with random access custom iterator states:
+// - pointer loop         : one index into the internal vectors, the baseline
+// - separate iterators   : one custom iterator per container, each compared with its end
+// - zip custom           : `make_zip_range` over the containers, one end compare
+// - zip pointers         : `make_zip_range` over the internal vectors
+// Kernels: dot product of 2 containers, `a = b + c * d` over 4 containers
+
+typedef CustomContainerWithTrivialIteratorState KernelContainer;
+
+static KernelContainer MakeKernelContainer(size_t count, int seed) {
+    KernelContainer container;
+    container.InternalData.resize(count);
+    for (size_t index = 0; index < count; ++index) {
+        container.InternalData[index].SetValue(static_cast<int>((index * 7 + seed) % 100));
+    }
+    return container;
+}
+
+struct PointerLoopKernel {
+    static int64_t dot(const KernelContainer &lhs, const KernelContainer &rhs) {
+        const CustomElement *left = lhs.InternalData.data();
+        const CustomElement *right = rhs.InternalData.data();
+        const size_t count = lhs.InternalData.size();
+        int64_t sum = 0;
+        for (size_t index = 0; index < count; ++index) {
+            sum += static_cast<int64_t>(left[index].GetValue()) * right[index].GetValue();
+        }
+        return sum;
+    }
+
+    static void multiplyAdd(KernelContainer &a, const KernelContainer &b, const KernelContainer &c, const KernelContainer &d) {
+        CustomElement *result = a.InternalData.data();
+        const size_t count = a.InternalData.size();
+        for (size_t index = 0; index < count; ++index) {
+            result[index].SetValue(b.InternalData[index].GetValue() + c.InternalData[index].GetValue() * d.InternalData[index].GetValue());
+        }
+    }
+};
+
+struct SeparateIteratorsKernel {
+    static int64_t dot(const KernelContainer &lhs, const KernelContainer &rhs) {
+        int64_t sum = 0;
+        auto left = lhs.cbegin();
+        auto right = rhs.cbegin();
+        for (; left != lhs.cend() && right != rhs.cend(); ++left, ++right) {
+            sum += static_cast<int64_t>(left->GetValue()) * right->GetValue();
+        }
+        return sum;
+    }
+
+    static void multiplyAdd(KernelContainer &a, const KernelContainer &b, const KernelContainer &c, const KernelContainer &d) {
+        auto itA = a.begin();
+        auto itB = b.cbegin();
+        auto itC = c.cbegin();
+        auto itD = d.cbegin();
+        for (; itA != a.end() && itB != b.cend() && itC != c.cend() && itD != d.cend(); ++itA, ++itB, ++itC, ++itD) {
+            itA->SetValue(itB->GetValue() + itC->GetValue() * itD->GetValue());
+        }
+    }
+};
+
+struct ZipCustomKernel {
+    static int64_t dot(const KernelContainer &lhs, const KernelContainer &rhs) {
+        int64_t sum = 0;
+        for (auto [left, right]: make_zip_range(lhs, rhs)) {
+            sum += static_cast<int64_t>(left.GetValue()) * right.GetValue();
+        }
+        return sum;
+    }
+
+    static void multiplyAdd(KernelContainer &a, const KernelContainer &b, const KernelContainer &c, const KernelContainer &d) {
+        for (auto [result, x, y, z]: make_zip_range(a, b, c, d)) {
+            result.SetValue(x.GetValue() + y.GetValue() * z.GetValue());
+        }
+    }
+};
+
+struct ZipPointersKernel {
+    static int64_t dot(const KernelContainer &lhs, const KernelContainer &rhs) {
+        int64_t sum = 0;
+        for (auto [left, right]: make_zip_range(lhs.InternalData, rhs.InternalData)) {
+            sum += static_cast<int64_t>(left.GetValue()) * right.GetValue();
+        }
+        return sum;
+    }
+
+    static void multiplyAdd(KernelContainer &a, const KernelContainer &b, const KernelContainer &c, const KernelContainer &d) {
+        for (auto [result, x, y, z]: make_zip_range(a.InternalData, b.InternalData, c.InternalData, d.InternalData)) {
+            result.SetValue(x.GetValue() + y.GetValue() * z.GetValue());
+        }
+    }
+};
+
+template<typename TKernel>
+void BM_ZipDotProduct(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    const KernelContainer lhs = MakeKernelContainer(count, 1);
+    const KernelContainer rhs = MakeKernelContainer(count, 2);
+
+    for (auto _ : state) {
+        int64_t sum = TKernel::dot(lhs, rhs);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    SetElementCounters(state, count, 2 * sizeof(CustomElement));
+}
+
+template<typename TKernel>
+void BM_ZipMultiplyAdd(benchmark::State &state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    KernelContainer a = MakeKernelContainer(count, 0);
+    const KernelContainer b = MakeKernelContainer(count, 1);
+    const KernelContainer c = MakeKernelContainer(count, 2);
+    const KernelContainer d = MakeKernelContainer(count, 3);
+
+    for (auto _ : state) {
+        TKernel::multiplyAdd(a, b, c, d);
+        benchmark::ClobberMemory();
+    }
+
+    SetElementCounters(state, count, 4 * sizeof(CustomElement));
+}
+
+BENCHMARK_TEMPLATE(BM_ZipDotProduct, PointerLoopKernel)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_ZipDotProduct, SeparateIteratorsKernel)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_ZipDotProduct, ZipCustomKernel)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_ZipDotProduct, ZipPointersKernel)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_ZipMultiplyAdd, PointerLoopKernel)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_ZipMultiplyAdd, SeparateIteratorsKernel)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_ZipMultiplyAdd, ZipCustomKernel)->Apply(ElementCounts);
+BENCHMARK_TEMPLATE(BM_ZipMultiplyAdd, ZipPointersKernel)->Apply(ElementCounts);
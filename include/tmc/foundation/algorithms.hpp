@@ -0,0 +1,229 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_algorithms_hpp_
+#define _tmc_foundation_algorithms_hpp_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include "custom-iterator-template.hpp"
+#include "packed-iterator.hpp"
+#include "segmented-iterator.hpp"
+
+// Algorithms dispatching on the iterator protocols, drop-in replacements of the std algorithms:
+// - packed iterators (packed-iterator.hpp) are processed a word at a time
+// - segmented iterators (segmented-iterator.hpp) run a tight loop per segment
+// - contiguous iterators (C++20) are unwrapped to raw pointers
+// - everything else falls back to the std algorithms
+
+namespace tmc {
+namespace foundation {
+
+namespace detail {
+
+    // Contiguous iterators are processed through raw pointers (memmove, memset, vectorized loops)
+#if __cplusplus >= 202002L
+    template<typename TIterator>
+    inline constexpr bool is_contiguous_iterator = std::contiguous_iterator<TIterator>;
+#else
+    template<typename TIterator>
+    inline constexpr bool is_contiguous_iterator = std::is_pointer<TIterator>::value;
+#endif
+
+    template<typename TIterator>
+    inline constexpr bool is_unwrappable_iterator = is_contiguous_iterator<TIterator> && !std::is_pointer<TIterator>::value;
+
+    template<typename TIterator>
+    inline auto unwrap(const TIterator &it) {
+#if __cplusplus >= 202002L
+        return std::to_address(it);
+#else
+        return it;
+#endif
+    }
+
+    template<typename TIterator>
+    inline constexpr bool is_forward_iterator = std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<TIterator>::iterator_category>::value;
+
+    // Operations summed up as integers by the packed `accumulate`
+    template<typename TBinaryOperation, typename T>
+    inline constexpr bool is_integral_plus = std::is_integral<T>::value && (std::is_same<TBinaryOperation, std::plus<>>::value || std::is_same<TBinaryOperation, std::plus<T>>::value);
+
+} // namespace detail
+
+template<typename TInputIterator, typename TFunction>
+inline TFunction for_each(TInputIterator first, TInputIterator last, TFunction function) {
+    if constexpr (segmented_iterator_traits<TInputIterator>::is_segmented) {
+        detail::for_each_segment(first, last, [&function](auto, auto localFirst, auto localLast) {
+            for (; localFirst != localLast; ++localFirst) {
+                function(*localFirst);
+            }
+            return true;
+        });
+        return function;
+    } else if constexpr (detail::is_unwrappable_iterator<TInputIterator>) {
+        return std::for_each(detail::unwrap(first), detail::unwrap(last), std::move(function));
+    } else {
+        return std::for_each(first, last, std::move(function));
+    }
+}
+
+template<typename TInputIterator, typename TOutputIterator>
+inline TOutputIterator copy(TInputIterator first, TInputIterator last, TOutputIterator result) {
+    if constexpr (detail::is_unwrappable_iterator<TOutputIterator>) {
+        auto *target = detail::unwrap(result);
+        return result + (tmc::foundation::copy(first, last, target) - target);
+    } else if constexpr (packed_iterator_traits<TInputIterator>::is_packed) {
+        typedef packed_iterator_traits<TInputIterator> traits;
+        typedef packed_iterator_traits<TOutputIterator> target_traits;
+        const std::size_t firstIndex = traits::index(first);
+        const std::size_t lastIndex = traits::index(last);
+        if constexpr (target_traits::is_packed) {
+            if constexpr (target_traits::bits == traits::bits) {
+                const std::size_t target = target_traits::index(result);
+                if (firstIndex % detail::packed_layout<traits::bits>::lanes == target % detail::packed_layout<traits::bits>::lanes) {
+                    detail::packed_copy_aligned<traits::bits>(traits::words(first), firstIndex, lastIndex, target_traits::words(result), target);
+                    return result + static_cast<typename TOutputIterator::difference_type>(lastIndex - firstIndex);
+                }
+            }
+        }
+
+        if constexpr (std::is_pointer<TOutputIterator>::value) {
+            return detail::packed_unpack<traits::bits>(traits::words(first), firstIndex, lastIndex, result);
+        } else {
+            detail::packed_decode<traits::bits>(traits::words(first), firstIndex, lastIndex, [&result](std::uint64_t value) {
+                *result = static_cast<typename traits::value_type>(value);
+                ++result;
+            });
+            return result;
+        }
+    } else if constexpr (packed_iterator_traits<TOutputIterator>::is_packed && detail::is_forward_iterator<TInputIterator>) {
+        typedef packed_iterator_traits<TOutputIterator> traits;
+        const std::size_t target = traits::index(result);
+        const auto count = std::distance(first, last);
+        detail::packed_encode<traits::bits>(traits::words(result), target, target + static_cast<std::size_t>(count), first);
+        return result + count;
+    } else if constexpr (segmented_iterator_traits<TInputIterator>::is_segmented) {
+        detail::for_each_segment(first, last, [&result](auto, auto localFirst, auto localLast) {
+            result = std::copy(localFirst, localLast, result);
+            return true;
+        });
+        return result;
+    } else if constexpr (detail::is_unwrappable_iterator<TInputIterator>) {
+        return std::copy(detail::unwrap(first), detail::unwrap(last), result);
+    } else {
+        return std::copy(first, last, result);
+    }
+}
+
+template<typename TForwardIterator, typename T>
+inline void fill(TForwardIterator first, TForwardIterator last, const T &value) {
+    if constexpr (packed_iterator_traits<TForwardIterator>::is_packed) {
+        typedef packed_iterator_traits<TForwardIterator> traits;
+        const auto element = static_cast<typename traits::value_type>(value);
+        detail::packed_fill<traits::bits>(traits::words(first), traits::index(first), traits::index(last), element);
+    } else if constexpr (segmented_iterator_traits<TForwardIterator>::is_segmented) {
+        detail::for_each_segment(first, last, [&value](auto, auto localFirst, auto localLast) {
+            std::fill(localFirst, localLast, value);
+            return true;
+        });
+    } else if constexpr (detail::is_unwrappable_iterator<TForwardIterator>) {
+        std::fill(detail::unwrap(first), detail::unwrap(last), value);
+    } else {
+        std::fill(first, last, value);
+    }
+}
+
+template<typename TInputIterator, typename T>
+inline TInputIterator find(TInputIterator first, TInputIterator last, const T &value) {
+    if constexpr (segmented_iterator_traits<TInputIterator>::is_segmented) {
+        typedef segmented_iterator_traits<TInputIterator> traits;
+        TInputIterator result = last;
+        detail::for_each_segment(first, last, [&](auto segment, auto localFirst, auto localLast) {
+            auto found = std::find(localFirst, localLast, value);
+            if (found == localLast) {
+                return true;
+            }
+
+            result = traits::compose(first, segment, found);
+            return false;
+        });
+        return result;
+    } else if constexpr (detail::is_unwrappable_iterator<TInputIterator>) {
+        auto *address = detail::unwrap(first);
+        return first + (std::find(address, detail::unwrap(last), value) - address);
+    } else {
+        return std::find(first, last, value);
+    }
+}
+
+template<typename TInputIterator, typename T>
+inline typename std::iterator_traits<TInputIterator>::difference_type count(TInputIterator first, TInputIterator last, const T &value) {
+    typedef typename std::iterator_traits<TInputIterator>::difference_type difference_type;
+    if constexpr (packed_iterator_traits<TInputIterator>::is_packed && std::is_integral<T>::value) {
+        typedef packed_iterator_traits<TInputIterator> traits;
+        // `element == value` compares in the common type of the usual arithmetic conversions, like `std::count`:
+        // -1 matches the 32 bit element 0xffffffff but no element of less than 32 bits
+        typedef typename std::common_type<typename traits::value_type, T>::type common_type;
+        const common_type target = static_cast<common_type>(value);
+        if constexpr (std::is_signed<common_type>::value) {
+            if (target < 0) {
+                return 0;
+            }
+        }
+        return static_cast<difference_type>(detail::packed_count<traits::bits>(traits::words(first), traits::index(first), traits::index(last), static_cast<std::uint64_t>(target)));
+    } else if constexpr (segmented_iterator_traits<TInputIterator>::is_segmented) {
+        difference_type result = 0;
+        detail::for_each_segment(first, last, [&](auto, auto localFirst, auto localLast) {
+            result += std::count(localFirst, localLast, value);
+            return true;
+        });
+        return result;
+    } else if constexpr (detail::is_unwrappable_iterator<TInputIterator>) {
+        return std::count(detail::unwrap(first), detail::unwrap(last), value);
+    } else {
+        return std::count(first, last, value);
+    }
+}
+
+template<typename TInputIterator, typename T, typename TBinaryOperation>
+inline T accumulate(TInputIterator first, TInputIterator last, T init, TBinaryOperation operation) {
+    if constexpr (packed_iterator_traits<TInputIterator>::is_packed) {
+        typedef packed_iterator_traits<TInputIterator> traits;
+        if constexpr (detail::is_integral_plus<TBinaryOperation, T>) {
+            return operation(std::move(init), static_cast<T>(detail::packed_sum<traits::bits>(traits::words(first), traits::index(first), traits::index(last))));
+        } else {
+            detail::packed_decode<traits::bits>(traits::words(first), traits::index(first), traits::index(last), [&](std::uint64_t value) {
+                init = operation(std::move(init), static_cast<typename traits::value_type>(value));
+            });
+            return init;
+        }
+    } else if constexpr (segmented_iterator_traits<TInputIterator>::is_segmented) {
+        detail::for_each_segment(first, last, [&](auto, auto localFirst, auto localLast) {
+            init = std::accumulate(localFirst, localLast, std::move(init), operation);
+            return true;
+        });
+        return init;
+    } else if constexpr (detail::is_unwrappable_iterator<TInputIterator>) {
+        return std::accumulate(detail::unwrap(first), detail::unwrap(last), std::move(init), operation);
+    } else {
+        return std::accumulate(first, last, std::move(init), operation);
+    }
+}
+
+template<typename TInputIterator, typename T>
+inline T accumulate(TInputIterator first, TInputIterator last, T init) {
+    return tmc::foundation::accumulate(first, last, std::move(init), std::plus<>());
+}
+
+} // namespace foundation
+}  // namespace tmc
+
+#endif
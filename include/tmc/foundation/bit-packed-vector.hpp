@@ -0,0 +1,231 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_bit_packed_vector_hpp_
+#define _tmc_foundation_bit_packed_vector_hpp_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include "custom-iterator-template.hpp"
+#include "custom-iterator-template-helper.hpp"
+#include "packed-iterator.hpp"
+#include "algorithms.hpp"
+
+// Vector of unsigned integers with `Bits` bits each, packed into 64 bit words (packed-iterator.hpp): `64 / Bits` elements
+// per word, e.g. 5 twelve bit or 21 three bit elements. The random access iterators return `bit_packed_reference` proxies,
+// `tmc::foundation::count`, `fill`, `copy` and `accumulate` (algorithms.hpp) process the words a word at a time.
+//
+//   tmc::foundation::bit_packed_vector<12> samples(1000000);
+//   tmc::foundation::fill(samples.begin(), samples.end(), 4095);
+//   auto sum = tmc::foundation::accumulate(samples.cbegin(), samples.cend(), std::uint64_t{0});
+
+namespace tmc {
+namespace foundation {
+
+template<unsigned Bits>
+class bit_packed_vector;
+
+// Smallest unsigned type holding `Bits` bits - the `value_type` of `bit_packed_vector<Bits>`
+template<unsigned Bits>
+using bit_packed_value_t = typename std::conditional<Bits <= 8, std::uint8_t, typename std::conditional<Bits <= 16, std::uint16_t, std::uint32_t>::type>::type;
+
+// Proxy reference to an element of a `bit_packed_vector` - behaves like `value_type &`
+// Assignments store the value truncated to `Bits` bits, `swap()` exchanges the elements (`std::sort`, `std::iter_swap`)
+template<unsigned Bits, bool is_const>
+class bit_packed_reference {
+    typedef detail::packed_layout<Bits> layout;
+
+    public:
+    typedef bit_packed_value_t<Bits> value_type;
+    typedef typename std::conditional<is_const, const std::uint64_t, std::uint64_t>::type word_type;
+
+    inline bit_packed_reference(word_type * word, unsigned shift): word_(word), shift_(shift) {}
+
+    // Copies refer to the same element, the assignments below write through
+    inline bit_packed_reference(const bit_packed_reference &) = default;
+
+    inline operator value_type() const { return static_cast<value_type>((*word_ >> shift_) & layout::mask); }
+
+    inline const bit_packed_reference & operator=(value_type value) const {
+        *word_ = (*word_ & ~(layout::mask << shift_)) | ((static_cast<std::uint64_t>(value) & layout::mask) << shift_);
+        return *this;
+    }
+
+    inline const bit_packed_reference & operator=(const bit_packed_reference & other) const { return *this = static_cast<value_type>(other); }
+
+    friend inline void swap(bit_packed_reference lhs, bit_packed_reference rhs) {
+        const value_type temporary = lhs;
+        lhs = static_cast<value_type>(rhs);
+        rhs = temporary;
+    }
+
+    private:
+    word_type * word_;
+    unsigned shift_;
+};
+
+// Iterator state of `bit_packed_vector<Bits>` - an element index, implements the packed iterator protocol
+template<unsigned Bits, bool is_const>
+struct bit_packed_state {
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef typename std::conditional<is_const, const bit_packed_vector<Bits>, bit_packed_vector<Bits>>::type container_type;
+    typedef typename std::conditional<is_const, const bit_packed_value_t<Bits>, bit_packed_value_t<Bits>>::type value_type;
+
+    // Proxy reference - `operator->()` returns an arrow proxy holding it
+    typedef bit_packed_reference<Bits, is_const> reference;
+
+    // Unconnected states are at index -1, connected states stay in [0, size()]
+    static constexpr bool compares_unconnected = true;
+
+    // Bits per element (Packed Iterators)
+    static constexpr unsigned packed_bits = Bits;
+
+    container_type * container_{nullptr};
+    std::ptrdiff_t current_{-1};
+
+    // Default Construction without container connection (ALL Iterators)
+    inline bit_packed_state() = default;
+
+    // Construction with connected container (ALL Iterators)
+    inline bit_packed_state(container_type * container): container_(container) {}
+
+    // Copy Construction - defaulted to keep the state trivially copyable (ALL Iterators)
+    inline bit_packed_state(const bit_packed_state & source) = default;
+
+    // Copy Construction from the changeable variant (ALL Iterators)
+    template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+    inline bit_packed_state(const bit_packed_state<Bits, other_is_const> & source): container_(source.container_), current_(source.current_) {}
+
+    // Start and End Positions (ALL Iterators)
+    inline void begin() { current_ = 0; }
+    inline void end() { current_ = static_cast<std::ptrdiff_t>(container_->size()); }
+
+    // Availability and Equality (ALL Iterators)
+    inline bool is_connected() const { return container_ != nullptr; }
+
+    template<bool other_is_const>
+    inline bool is_equal(const bit_packed_state<Bits, other_is_const> & other) const { return current_ == other.current_; }
+
+    // Move Next (ALL Iterators)
+    inline void next() { ++current_; }
+
+    // Element Access (ALL Iterators)
+    inline reference get() const { return at(0); }
+
+    // Move Previous (Bidirectional, Random Access Iterators)
+    inline void prev() { --current_; }
+
+    // Move to position (Random Access Iterators)
+    inline void move(std::ptrdiff_t offset) { current_ += offset; }
+
+    // Calculate Distance (Random Access Iterators)
+    template<bool other_is_const>
+    inline std::ptrdiff_t distance(const bit_packed_state<Bits, other_is_const> & rhs) const { return current_ - rhs.current_; }
+
+    // Element access at position (Random Access Iterators)
+    inline reference at(std::ptrdiff_t offset) const {
+        const std::size_t index = static_cast<std::size_t>(current_ + offset);
+        return reference(container_->words() + index / detail::packed_layout<Bits>::lanes, static_cast<unsigned>(index % detail::packed_layout<Bits>::lanes * Bits));
+    }
+
+    // Packed words and element index of the current position (Packed Iterators)
+    inline auto * words() const { return container_->words(); }
+    inline std::size_t index() const { return static_cast<std::size_t>(current_); }
+
+    // Modification count of the vector (Checked Iterators)
+    inline std::size_t generation() const { return container_->generation_; }
+};
+
+// Vector of `Bits` wide unsigned integers (1 ... 32 bits), 64 / Bits elements per 64 bit word
+// Stored values are truncated to `Bits` bits. The bits of a word behind its last element are zero.
+template<unsigned Bits>
+class bit_packed_vector {
+    typedef detail::packed_layout<Bits> layout;
+
+    template<bool is_const>
+    using iterator_state = bit_packed_state<Bits, is_const>;
+
+    template<unsigned, bool>
+    friend struct bit_packed_state;
+
+    public:
+    typedef bit_packed_value_t<Bits> value_type;
+    typedef std::size_t size_type;
+    typedef bit_packed_reference<Bits, false> reference;
+    typedef bit_packed_reference<Bits, true> const_reference;
+
+    static constexpr unsigned bits = Bits;
+    static constexpr std::size_t elements_per_word = layout::lanes;
+
+    inline bit_packed_vector() = default;
+
+    explicit bit_packed_vector(size_type count, value_type value = 0) { resize(count, value); }
+
+    bit_packed_vector(std::initializer_list<value_type> values) {
+        resize(values.size());
+        tmc::foundation::copy(values.begin(), values.end(), begin());
+    }
+
+    inline std::size_t size() const { return size_; }
+    inline bool empty() const { return size_ == 0; }
+
+    // Bytes of the packed words
+    inline std::size_t size_bytes() const { return words_.size() * sizeof(std::uint64_t); }
+
+    inline std::uint64_t * words() { return words_.data(); }
+    inline const std::uint64_t * words() const { return words_.data(); }
+
+    inline reference operator[](std::size_t index) { return reference(words_.data() + index / layout::lanes, shift(index)); }
+    inline value_type operator[](std::size_t index) const { return const_reference(words_.data() + index / layout::lanes, shift(index)); }
+
+    void reserve(size_type count) { words_.reserve(word_count(count)); }
+
+    void resize(size_type count, value_type value = 0) {
+        if (count < size_) {
+            detail::packed_fill<Bits>(words_.data(), count, std::min(size_, word_count(count) * layout::lanes), 0);
+        }
+
+        words_.resize(word_count(count));
+        if (count > size_ && value != 0) {
+            detail::packed_fill<Bits>(words_.data(), size_, count, value);
+        }
+        size_ = count;
+        ++generation_;
+    }
+
+    void push_back(value_type value) {
+        if (size_ % layout::lanes == 0) {
+            words_.push_back(0);
+        }
+        (*this)[size_++] = value;
+        ++generation_;
+    }
+
+    void clear() {
+        words_.clear();
+        size_ = 0;
+        ++generation_;
+    }
+
+    SETUP_RANGE_ITERATORS(iterator_state);
+    SETUP_REVERSE_ITERATORS(iterator_state);
+
+    private:
+    static inline std::size_t word_count(size_type count) { return (count + layout::lanes - 1) / layout::lanes; }
+    static inline unsigned shift(std::size_t index) { return static_cast<unsigned>(index % layout::lanes * Bits); }
+
+    std::vector<std::uint64_t> words_;
+    std::size_t size_{0};
+    // Modification count - size changes move the end and may move the words
+    std::size_t generation_{0};
+};
+
+} // namespace foundation
+}  // namespace tmc
+
+#endif
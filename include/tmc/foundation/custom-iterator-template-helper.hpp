@@ -4,6 +4,13 @@
 #ifndef _tmc_foundation_custom_iterator_template_helper_hpp_
 #define _tmc_foundation_custom_iterator_template_helper_hpp_
 #include "custom-iterator-template.hpp"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
        
 // Use this define to declare both:
 // - `iterator`
@@ -13,16 +20,23 @@
   SETUP_CONST_ITERATOR(STATE_STRUCT)
 
 // Use this define to declare only `iterator`
-#define SETUP_MUTABLE_ITERATOR(STATE_STRUCT) \
-  typedef tmc::foundation::custom_iterator_template< STATE_STRUCT , false> iterator; \
-  iterator begin() { return iterator::begin(this); } \
-  iterator end()   { return iterator::end(this);   }
+// `end()` returns a `custom_iterator_sentinel` if the state implements `is_end()`
+#define SETUP_MUTABLE_ITERATOR(STATE_STRUCT) TMC_SETUP_MUTABLE_ITERATOR(STATE_STRUCT, )
 
 // Use this define to declare only `const_iterator`
-#define SETUP_CONST_ITERATOR(STATE_STRUCT) \
-  typedef tmc::foundation::custom_iterator_template<STATE_STRUCT, true> const_iterator; \
-  const_iterator cbegin() const { return const_iterator::begin(this); } \
-  const_iterator cend()   const { return const_iterator::end(this);   }
+// `cend()` returns a `custom_iterator_sentinel` if the state implements `is_end()`
+#define SETUP_CONST_ITERATOR(STATE_STRUCT) TMC_SETUP_CONST_ITERATOR(STATE_STRUCT, )
+
+// Use these defines instead of SETUP_ITERATORS / SETUP_CONST_ITERATOR to declare `begin() const` / `end() const` too:
+// const containers are ranges (`std::ranges::range<const Container>`)
+// `end() const` returns a `custom_iterator_sentinel` if the state implements `is_end()`
+#define SETUP_RANGE_ITERATORS(STATE_STRUCT) \
+  SETUP_MUTABLE_ITERATOR(STATE_STRUCT) \
+  SETUP_CONST_RANGE_ITERATOR(STATE_STRUCT)
+
+#define SETUP_CONST_RANGE_ITERATOR(STATE_STRUCT) \
+  TMC_SETUP_CONST_ITERATOR(STATE_STRUCT, ) \
+  TMC_SETUP_CONST_RANGE_ACCESSORS(STATE_STRUCT, )
 
 
 // Use this define to declare both:
@@ -33,22 +47,183 @@
   SETUP_CONST_RITERATOR(STATE_STRUCT)
 
 // Use this define to declare only `reverse_iterator`
-// `begin()` and `end()` must be defined
-#define SETUP_MUTABLE_RITERATOR(STATE_STRUCT) \
-  typedef std::reverse_iterator<tmc::foundation::custom_iterator_template<STATE_STRUCT, false>> reverse_iterator; \
-  reverse_iterator rbegin() { return reverse_iterator(end()); } \
-  reverse_iterator rend()   { return reverse_iterator(begin()); } 
+// States implementing `rbegin()` / `rend()` get a native reverse iterator, all others a `std::reverse_iterator` (`end()` must be implemented in the state)
+#define SETUP_MUTABLE_RITERATOR(STATE_STRUCT) TMC_SETUP_MUTABLE_RITERATOR(STATE_STRUCT, )
 
 // Use this define to declare only `const_reverse_iterator`
-// `cbegin()` and `cend()` must be defined
-#define SETUP_CONST_RITERATOR(STATE_STRUCT) \
-  typedef std::reverse_iterator<tmc::foundation::custom_iterator_template<STATE_STRUCT, true>> const_reverse_iterator; \
-  const_reverse_iterator rbegin() const {return const_reverse_iterator(cend()); } \
-  const_reverse_iterator rend() const { return const_reverse_iterator(cbegin()); }
+// States implementing `rbegin()` / `rend()` get a native reverse iterator, all others a `std::reverse_iterator` (`end()` must be implemented in the state)
+#define SETUP_CONST_RITERATOR(STATE_STRUCT) TMC_SETUP_CONST_RITERATOR(STATE_STRUCT, )
+
+
+// Use these defines instead of SETUP_RANGE_ITERATORS / SETUP_REVERSE_ITERATORS to declare `constexpr` accessors: the containers
+// are iterable in constant expressions. Literal states with `constexpr` hooks only, the iterators must be literal types.
+#define SETUP_CONSTEXPR_ITERATORS(STATE_STRUCT) \
+  TMC_SETUP_MUTABLE_ITERATOR(STATE_STRUCT, constexpr) \
+  TMC_SETUP_CONST_ITERATOR(STATE_STRUCT, constexpr) \
+  TMC_SETUP_CONST_RANGE_ACCESSORS(STATE_STRUCT, constexpr)
+
+#define SETUP_CONSTEXPR_REVERSE_ITERATORS(STATE_STRUCT) \
+  TMC_SETUP_MUTABLE_RITERATOR(STATE_STRUCT, constexpr) \
+  TMC_SETUP_CONST_RITERATOR(STATE_STRUCT, constexpr)
+
+
+// Accessor declarations of the SETUP_* defines, `SPECIFIER` is empty or `constexpr`
+#define TMC_SETUP_MUTABLE_ITERATOR(STATE_STRUCT, SPECIFIER) \
+  typedef tmc::foundation::custom_iterator_template< STATE_STRUCT , false> iterator; \
+  SPECIFIER iterator begin() { return iterator::begin(this); } \
+  SPECIFIER typename iterator::sentinel_type end() { return iterator::sentinel(this); }
+
+#define TMC_SETUP_CONST_ITERATOR(STATE_STRUCT, SPECIFIER) \
+  typedef tmc::foundation::custom_iterator_template<STATE_STRUCT, true> const_iterator; \
+  SPECIFIER const_iterator cbegin() const { return const_iterator::begin(this); } \
+  SPECIFIER typename const_iterator::sentinel_type cend() const { return const_iterator::sentinel(this); }
+
+#define TMC_SETUP_CONST_RANGE_ACCESSORS(STATE_STRUCT, SPECIFIER) \
+  SPECIFIER const_iterator begin() const { return const_iterator::begin(this); } \
+  SPECIFIER typename const_iterator::sentinel_type end() const { return const_iterator::sentinel(this); }
+
+#define TMC_SETUP_MUTABLE_RITERATOR(STATE_STRUCT, SPECIFIER) \
+  typedef typename tmc::foundation::reverse_iterator_setup<STATE_STRUCT, false>::type reverse_iterator; \
+  SPECIFIER reverse_iterator rbegin() { return tmc::foundation::reverse_iterator_setup<STATE_STRUCT, false>::rbegin(this); } \
+  SPECIFIER reverse_iterator rend()   { return tmc::foundation::reverse_iterator_setup<STATE_STRUCT, false>::rend(this); }
+
+#define TMC_SETUP_CONST_RITERATOR(STATE_STRUCT, SPECIFIER) \
+  typedef typename tmc::foundation::reverse_iterator_setup<STATE_STRUCT, true>::type const_reverse_iterator; \
+  SPECIFIER const_reverse_iterator rbegin() const { return tmc::foundation::reverse_iterator_setup<STATE_STRUCT, true>::rbegin(this); } \
+  SPECIFIER const_reverse_iterator rend() const { return tmc::foundation::reverse_iterator_setup<STATE_STRUCT, true>::rend(this); }
+
+// Use this define at global namespace scope to declare a non owning container as `std::ranges::view` and `std::ranges::borrowed_range` (C++20)
+// - views: copying the container is cheap and does not copy the elements
+// - borrowed ranges: the iterators stay valid when the container object is gone, the state must not access the container after `begin()` / `end()`
+#if __cplusplus >= 202002L
+#define SETUP_BORROWED_VIEW(CONTAINER_CLASS) \
+  template<> inline constexpr bool std::ranges::enable_view<CONTAINER_CLASS> = true; \
+  template<> inline constexpr bool std::ranges::enable_borrowed_range<CONTAINER_CLASS> = true;
+#else
+#define SETUP_BORROWED_VIEW(CONTAINER_CLASS)
+#endif
 
 namespace tmc {
 namespace foundation {
-        
+
+namespace detail {
+
+    // Optional state hooks: `void rbegin()` / `void rend()` - native reverse iteration. `rbegin()` positions the state on the
+    // last element, `rend()` before the first element: `prev()` moves from the first element to the `rend()` position,
+    // `next()` moves back. The reverse iterator steps with `prev()` and reads with `get()`, no copy per element access
+    template<typename TState, typename = void>
+    struct has_native_reverse: std::false_type {};
+
+    template<typename TState>
+    struct has_native_reverse<TState, std::void_t<decltype(std::declval<TState &>().rbegin()), decltype(std::declval<TState &>().rend())>>: std::true_type {};
+
+} // namespace detail
+
+// Reverse state of a state implementing `rbegin()` / `rend()`
+// `begin()` / `end()` are `rbegin()` / `rend()`, `next()` / `prev()` are swapped, moves, distances and offsets are mirrored.
+// The connection and checking hooks are forwarded, contiguous states reverse to random access states.
+template<template<bool> typename TIteratorState>
+struct native_reverse_state {
+
+    template<bool is_const>
+    struct state {
+        typedef TIteratorState<is_const> forward_state;
+
+        typedef detail::legacy_iterator_category<typename forward_state::iterator_category> iterator_category;
+        typedef typename forward_state::container_type container_type;
+        typedef typename forward_state::value_type value_type;
+        typedef typename detail::state_reference<forward_state>::type reference;
+        typedef typename detail::state_pointer<forward_state, reference>::type pointer;
+
+        static constexpr bool compares_unconnected = detail::compares_unconnected<forward_state>::value;
+
+        forward_state forward_;
+
+        // Default Construction without container connection (ALL Iterators)
+        constexpr state() = default;
+
+        // Construction with connected container (ALL Iterators)
+        constexpr state(container_type * container): forward_(container) {}
+
+        // Copy Construction from the changeable variant (ALL Iterators)
+        template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+        constexpr state(const state<other_is_const> & source): forward_(source.forward_) {}
+
+        // Start and End Positions (ALL Iterators)
+        constexpr void begin() { forward_.rbegin(); }
+        constexpr void end() { forward_.rend(); }
+
+        // Availability and Equality (ALL Iterators)
+        constexpr bool is_connected() const { return forward_.is_connected(); }
+
+        template<bool other_is_const>
+        constexpr bool is_equal(const state<other_is_const> & other) const { return forward_.is_equal(other.forward_); }
+
+        // Move Next (ALL Iterators)
+        constexpr void next() { forward_.prev(); }
+
+        // Element Access (ALL Iterators)
+        constexpr reference get() { return forward_.get(); }
+
+        // Move Previous (Bidirectional, Random Access Iterators)
+        constexpr void prev() { forward_.next(); }
+
+        // Move to position (Random Access Iterators)
+        constexpr void move(std::ptrdiff_t offset) { forward_.move(-offset); }
+
+        // Calculate Distance (Random Access Iterators)
+        template<bool other_is_const>
+        constexpr std::ptrdiff_t distance(const state<other_is_const> & rhs) const { return rhs.forward_.distance(forward_); }
+
+        // Element access at position (Random Access Iterators)
+        constexpr reference at(std::ptrdiff_t offset) { return forward_.at(-offset); }
+
+        // Checking hooks, only if the forward state implements them
+        template<typename T = forward_state>
+        constexpr auto generation() const -> decltype(std::declval<const T &>().generation()) { return forward_.generation(); }
+
+        template<typename T = forward_state>
+        constexpr auto container() const -> decltype(std::declval<const T &>().container()) { return forward_.container(); }
+
+        // The reverse begin position is the last element of the forward state
+        template<typename T = forward_state>
+        constexpr auto index() const -> decltype(std::declval<const T &>().index()) { return forward_.size() - 1 - forward_.index(); }
+
+        template<typename T = forward_state>
+        constexpr auto size() const -> decltype(std::declval<const T &>().size()) { return forward_.size(); }
+    };
+};
+
+// Reverse iterator of the SETUP_*RITERATOR defines: iterators over the `native_reverse_state` of states implementing
+// `rbegin()` / `rend()`, `std::reverse_iterator` of the forward iterator otherwise
+template<template<bool> typename TIteratorState, bool is_const>
+struct reverse_iterator_setup {
+    typedef typename TIteratorState<is_const>::container_type container_type;
+    typedef custom_iterator_template<TIteratorState, is_const> forward_iterator;
+
+    static constexpr bool is_native = detail::has_native_reverse<TIteratorState<is_const>>::value;
+
+    typedef typename std::conditional<is_native,
+        custom_iterator_template<native_reverse_state<TIteratorState>::template state, is_const>,
+        std::reverse_iterator<forward_iterator>>::type type;
+
+    static constexpr type rbegin(container_type * container) {
+        if constexpr (is_native) {
+            return type::begin(container);
+        } else {
+            return type(forward_iterator::end(container));
+        }
+    }
+
+    static constexpr type rend(container_type * container) {
+        if constexpr (is_native) {
+            return type::end(container);
+        } else {
+            return type(forward_iterator::begin(container));
+        }
+    }
+};
+
 } // namespace foundation
 }  // namespace tmc
 #endif // _tmc_foundation_custom_iterator_template_hpp_
\ No newline at end of file
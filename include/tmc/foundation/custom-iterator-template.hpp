@@ -4,75 +4,436 @@
 #ifndef _tmc_foundation_custom_iterator_template_hpp_
 #define _tmc_foundation_custom_iterator_template_hpp_
 
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
 #include <iterator>
+#include <memory>
+#include <type_traits>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+// Iterator checks: `TMC_CUSTOM_ITERATOR_CHECKED` 1 or 0, defaults to checked builds if `NDEBUG` is not defined
+// All translation units of a program must use the same setting for the iterator types they share
+#ifndef TMC_CUSTOM_ITERATOR_CHECKED
+#ifdef NDEBUG
+#define TMC_CUSTOM_ITERATOR_CHECKED 0
+#else
+#define TMC_CUSTOM_ITERATOR_CHECKED 1
+#endif
+#endif
 
 namespace tmc {
 namespace foundation {
 
-template<template<bool> typename TIteratorState, bool is_const>
-struct custom_iterator_template {
+// Check policy of checked iterators - asserts on the use of invalid iterators:
+// - dereference of unconnected iterators, invalidated iterators (states implementing `generation()`) and end positions
+// - comparison and distance of iterators of different containers (states implementing `container()`)
+// - `move()` and `at()` out of [begin, end] (random access states implementing `container()`)
+// Own policies provide `enabled` and `failed()`, which must not return (abort or throw)
+struct checked_iterator_policy {
+    static constexpr bool enabled = true;
+
+    [[noreturn]] static void failed(const char * message) {
+        std::fprintf(stderr, "custom_iterator_template check failed: %s\n", message);
+        std::abort();
+    }
+};
+
+// Check policy of unchecked iterators - no checks at all, not even the connection checks of the comparison:
+// comparing unconnected (default constructed) iterators calls the state's `is_equal()`
+struct unchecked_iterator_policy {
+    static constexpr bool enabled = false;
+};
+
+// Check policy of `custom_iterator_template` unless given explicitly, selected by `TMC_CUSTOM_ITERATOR_CHECKED`
+typedef std::conditional<TMC_CUSTOM_ITERATOR_CHECKED != 0, checked_iterator_policy, unchecked_iterator_policy>::type default_iterator_policy;
+
+// Iterator operations counted by instrumentation policies
+enum class iterator_operation { next, prev, move, get, is_equal, copy };
+
+inline constexpr std::size_t iterator_operation_count = 6;
+
+// Instrumentation policy of uninstrumented iterators - the default, no counting and no storage
+// Instrumentation policies provide `enabled` and `template<typename TIterator> static void count(iterator_operation)`,
+// e.g. `counting_instrumentation` of `iterator-instrumentation.hpp`
+struct no_instrumentation {
+    static constexpr bool enabled = false;
+};
+
+// End marker returned by `end()` for states implementing `is_end()`
+// Loops compare against it with a single `is_end()` test instead of a fully constructed end iterator
+struct custom_iterator_sentinel {};
+
+// `operator->()` result for proxy references: keeps the proxy alive for the member access
+template<typename TReference>
+struct arrow_proxy {
+    TReference reference_;
+
+    constexpr arrow_proxy(TReference reference): reference_(std::move(reference)) {}
+    constexpr TReference * operator->() { return &reference_; }
+    constexpr const TReference * operator->() const { return &reference_; }
+};
+
+// Post-increment result of single pass iterators whose copies share the position: holds the value before the increment
+template<typename TValue>
+struct postfix_proxy {
+    TValue value_;
+
+    constexpr const TValue & operator*() const { return value_; }
+};
+
+namespace detail {
+
+    // Optional state hook: `bool is_end() const` - true if the state is behind the last element. Checked iterators of states
+    // implementing `container()` test it on dereference
+    template<typename TState, typename = void>
+    struct has_is_end: std::false_type {};
+
+    template<typename TState>
+    struct has_is_end<TState, std::void_t<decltype(std::declval<const TState &>().is_end())>>: std::true_type {};
+
+    // Optional state flag: `static constexpr bool compares_unconnected = true` - the state's `is_equal()` is correct
+    // for unconnected (default constructed) states too, or they are never compared: the connection checks are skipped
+    template<typename TState, typename = void>
+    struct compares_unconnected: std::false_type {};
+
+    template<typename TState>
+    struct compares_unconnected<TState, std::void_t<decltype(TState::compares_unconnected)>>: std::integral_constant<bool, TState::compares_unconnected> {};
+
+    // Optional state flag: `static constexpr bool copies_share_position = true` - copies of the state read from the same
+    // position as the source (single pass sources like streams): `it++` returns a `postfix_proxy` holding the old value
+    template<typename TState, typename = void>
+    struct copies_share_position: std::false_type {};
+
+    template<typename TState>
+    struct copies_share_position<TState, std::void_t<decltype(TState::copies_share_position)>>: std::integral_constant<bool, TState::copies_share_position> {};
+
+    // Optional state hook: `value_type * address() const` - raw address of the current element, valid at the end position too
+    template<typename TState, typename = void>
+    struct has_address: std::false_type {};
+
+    template<typename TState>
+    struct has_address<TState, std::void_t<decltype(std::declval<const TState &>().address())>>: std::true_type {};
+
+    // Optional state hook: `std::span<value_type> next_chunk(std::ptrdiff_t max)` - up to `max` contiguous elements from the
+    // current position on, the state moves behind them. Empty at the end, never crosses the end of the container
+    template<typename TState, typename = void>
+    struct has_next_chunk: std::false_type {};
+
+#if __cplusplus >= 202002L
+    template<typename TState>
+    struct has_next_chunk<TState, std::void_t<decltype(std::declval<TState &>().next_chunk(std::ptrdiff_t{}))>>: std::true_type {};
+#endif
+
+    // Optional state hook: `std::size_t generation() const` - modification count of the connected container. Checked
+    // iterators record it when they are positioned by `begin()` / `end()` and assert it is unchanged on dereference
+    template<typename TState, typename = void>
+    struct has_generation: std::false_type {};
+
+    template<typename TState>
+    struct has_generation<TState, std::void_t<decltype(std::declval<const TState &>().generation())>>: std::true_type {};
+
+    // Optional state hook: `container_type * container() const` - the connected container. Checked iterators compare it
+    // on comparison and distance, and test `is_end()` on dereference
+    template<typename TState, typename = void>
+    struct has_container: std::false_type {};
+
+    template<typename TState>
+    struct has_container<TState, std::void_t<decltype(std::declval<const TState &>().container())>>: std::true_type {};
+
+    // Optional state hooks: `std::ptrdiff_t index() const` - distance of the current position from the begin position,
+    // `std::ptrdiff_t size() const` - distance of the end position from the begin position. Checked iterators of states
+    // implementing both check moves and offset accesses against them, without building begin or end states
+    template<typename TState, typename = void>
+    struct has_index: std::false_type {};
+
+    template<typename TState>
+    struct has_index<TState, std::void_t<decltype(std::declval<const TState &>().index()), decltype(std::declval<const TState &>().size())>>: std::true_type {};
+
+    // Optional state flag: `static constexpr bool collapses_to_pointer = true` - the state is a position in a contiguous
+    // element array without other semantics: `address()` is the element pointer at every position including the end,
+    // `begin()` / `end()` are the only container accesses. Unchecked, uninstrumented iterators store `address()` only.
+    // States implementing `is_end()` or `next_chunk()` keep their state: the element pointer has neither hook
+    template<typename TState, typename = void>
+    struct collapses_to_pointer: std::false_type {};
+
+    template<typename TState>
+    struct collapses_to_pointer<TState, std::void_t<decltype(TState::collapses_to_pointer)>>: std::integral_constant<bool, TState::collapses_to_pointer> {};
+
+    // Class declaring the member `TMember` points to
+    template<typename TMember>
+    struct member_class {};
+
+    template<typename TResult, typename TClass>
+    struct member_class<TResult TClass::*> { typedef TClass type; };
+
+    // `address()` is declared by `TState` itself, not inherited: decorators deriving from a collapsing state add members
+    // of their own and inherit the flag along with the hooks, they do not collapse unless they declare `address()` too
+    template<typename TState, typename = void>
+    struct declares_address: std::false_type {};
+
+    template<typename TState>
+    struct declares_address<TState, std::void_t<typename member_class<decltype(&TState::address)>::type>>: std::is_same<typename member_class<decltype(&TState::address)>::type, TState> {};
+
+    // Position tags of the iterator construction
+    struct begin_position {};
+    struct end_position {};
+
+    // Storage of collapsed iterators: the element pointer of `TIteratorState<is_const>`, all operations are pointer arithmetic
+    // Unconnected iterators (and the positions of empty containers with a null element array) are null pointers
+    template<template<bool> typename TIteratorState, bool is_const>
+    struct pointer_state {
+        typedef TIteratorState<is_const> state_type;
+        typedef typename state_type::iterator_category iterator_category;
+        typedef typename state_type::container_type container_type;
+        typedef typename state_type::value_type value_type;
+
+        value_type * current_{nullptr};
+
+        inline pointer_state() = default;
+        constexpr explicit pointer_state(value_type * current): current_(current) {}
+
+        template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+        constexpr pointer_state(const pointer_state<TIteratorState, other_is_const> & source): current_(source.current_) {}
+
+        // Positions taken from the collapsed state
+        static constexpr pointer_state at_begin(container_type * container) {
+            state_type state(container);
+            state.begin();
+            return pointer_state(state.address());
+        }
+
+        static constexpr pointer_state at_end(container_type * container) {
+            state_type state(container);
+            state.end();
+            return pointer_state(state.address());
+        }
+
+        constexpr bool is_connected() const { return current_ != nullptr; }
+
+        template<bool other_is_const>
+        constexpr bool is_equal(const pointer_state<TIteratorState, other_is_const> & other) const { return current_ == other.current_; }
+
+        constexpr void next() { ++current_; }
+        constexpr value_type & get() const { return *current_; }
+        constexpr value_type * address() const { return current_; }
+        constexpr void prev() { --current_; }
+        constexpr void move(std::ptrdiff_t offset) { current_ += offset; }
+
+        template<bool other_is_const>
+        constexpr std::ptrdiff_t distance(const pointer_state<TIteratorState, other_is_const> & rhs) const { return current_ - rhs.current_; }
+
+        constexpr value_type & at(std::ptrdiff_t offset) const { return current_[offset]; }
+    };
+
+    // Generation recorded by checked iterators, empty (no storage) otherwise
+    template<bool is_recorded>
+    struct recorded_generation {
+        std::size_t generation_{0};
+    };
+
+    template<>
+    struct recorded_generation<false> {};
+
+    // Copy counting of instrumented iterators, empty and trivially copyable otherwise
+    // Moves are counted as copies: iterators are copied by value
+    template<typename TInstrumentation, typename TIterator, bool is_enabled = TInstrumentation::enabled>
+    struct instrumented_copies {
+        inline instrumented_copies() = default;
+        constexpr instrumented_copies(const instrumented_copies &) { TInstrumentation::template count<TIterator>(iterator_operation::copy); }
+
+        constexpr instrumented_copies & operator=(const instrumented_copies &) {
+            TInstrumentation::template count<TIterator>(iterator_operation::copy);
+            return *this;
+        }
+    };
+
+    template<typename TInstrumentation, typename TIterator>
+    struct instrumented_copies<TInstrumentation, TIterator, false> {};
+
+    // Optional state typedef: `typedef ... reference;` - element access type, a proxy object for states without element
+    // objects in memory (e.g. struct of arrays); `value_type &` if not defined
+    template<typename TState, typename = void>
+    struct state_reference {
+        typedef typename TState::value_type & type;
+    };
+
+    template<typename TState>
+    struct state_reference<TState, std::void_t<typename TState::reference>> {
+        typedef typename TState::reference type;
+    };
+
+    // Optional state typedef: `typedef ... pointer;` - result of `operator->()`, constructible from `reference` for proxies;
+    // `value_type *` for references and `arrow_proxy<reference>` for proxies if not defined
+    template<typename TState, typename TReference, typename = void>
+    struct state_pointer {
+        typedef typename std::conditional<std::is_reference<TReference>::value, std::remove_reference_t<TReference> *, arrow_proxy<TReference>>::type type;
+    };
+
+    template<typename TState, typename TReference>
+    struct state_pointer<TState, TReference, std::void_t<typename TState::pointer>> {
+        typedef typename TState::pointer type;
+    };
+
+    // Contiguous states are contiguous iterators in C++20, legacy algorithms dispatch on std::random_access_iterator_tag
+#if __cplusplus >= 202002L
+    template<typename TCategory>
+    using legacy_iterator_category = typename std::conditional<std::is_base_of<std::contiguous_iterator_tag, TCategory>::value, std::random_access_iterator_tag, TCategory>::type;
+#else
+    template<typename TCategory>
+    using legacy_iterator_category = TCategory;
+#endif
+
+} // namespace detail
+
+// State access for extensions built on top of the template (segmented iterators, chunked access, ...)
+struct custom_iterator_access {
+    template<typename TIterator>
+    static constexpr auto & state(TIterator & iterator) { return iterator.iteratorState_; }
+
+    template<typename TIterator>
+    static constexpr const auto & state(const TIterator & iterator) { return iterator.iteratorState_; }
+};
+
+template<template<bool> typename TIteratorState, bool is_const, typename TCheckPolicy = default_iterator_policy, typename TInstrumentation = no_instrumentation>
+struct custom_iterator_template:
+    private detail::recorded_generation<TCheckPolicy::enabled && detail::has_generation<TIteratorState<is_const>>::value>,
+    private detail::instrumented_copies<TInstrumentation, custom_iterator_template<TIteratorState, is_const, TCheckPolicy, TInstrumentation>> {
 
     static_assert(std::is_base_of<std::input_iterator_tag, typename TIteratorState<is_const>::iterator_category>::value, "Iterator category must be/derive from std::forward_iterator_tag");
 
     static_assert(std::is_member_function_pointer<decltype(&TIteratorState<is_const>::begin)>::value,"begin() is not defined in iterator state"); 
 
+#if __cplusplus >= 202002L
+    static_assert(!std::is_base_of<std::contiguous_iterator_tag, typename TIteratorState<is_const>::iterator_category>::value || detail::has_address<TIteratorState<is_const>>::value, "address() must be defined in iterator state for contiguous iterators");
+#endif
 
 
-    typedef typename TIteratorState<is_const>::iterator_category    iterator_category;
+    typedef typename TIteratorState<is_const>::iterator_category    iterator_concept;
+    typedef detail::legacy_iterator_category<iterator_concept>      iterator_category;
     typedef typename TIteratorState<is_const>::container_type       container_type;
     typedef typename TIteratorState<is_const>::value_type           value_type;
-    typedef typename TIteratorState<is_const>::value_type &         element_access_type;
+    typedef typename detail::state_reference<TIteratorState<is_const>>::type     element_access_type;
     typedef typename std::ptrdiff_t                                 difference_type;
-    typedef typename TIteratorState<is_const>::value_type *         pointer;
-    typedef typename TIteratorState<is_const>::value_type &         reference;
+    typedef typename detail::state_pointer<TIteratorState<is_const>, element_access_type>::type pointer;
+    typedef element_access_type                                     reference;
+
+    // End marker type: `custom_iterator_sentinel` for states implementing `is_end()`, the iterator itself otherwise
+    typedef typename std::conditional<detail::has_is_end<TIteratorState<is_const>>::value, custom_iterator_sentinel, custom_iterator_template>::type sentinel_type;
 
     // *** Start and End Positions ***
-    static custom_iterator_template begin(container_type *ref) {
-        custom_iterator_template it(ref);
-        it.begin();
-        return it;
+    static constexpr custom_iterator_template begin(container_type *ref) {
+        return custom_iterator_template(ref, detail::begin_position{});
+    }
+
+    static constexpr custom_iterator_template end(container_type *ref) {
+        return custom_iterator_template(ref, detail::end_position{});
     }
 
-    static custom_iterator_template end(container_type *ref) {
-        custom_iterator_template it(ref);
-        it.end();
-        return it;
+    // End marker - does not construct an iterator (and does not need `end()` in the state) if the state implements `is_end()`
+    static constexpr sentinel_type sentinel(container_type *ref) {
+        if constexpr (detail::has_is_end<TIteratorState<is_const>>::value) {
+            return custom_iterator_sentinel{};
+        } else {
+            return end(ref);
+        }
     }
 
 
     // *** construction ***
     inline custom_iterator_template() = default;
 
-    inline custom_iterator_template(const custom_iterator_template & source): iteratorState_(source.iteratorState_) {}
+    // Copy, move and destruction are defaulted: the iterator is trivially copyable whenever `TIteratorState` is
+    inline custom_iterator_template(const custom_iterator_template & source) = default;
+    inline custom_iterator_template(custom_iterator_template && source) = default;
+    inline custom_iterator_template & operator=(const custom_iterator_template & source) = default;
+    inline custom_iterator_template & operator=(custom_iterator_template && source) = default;
+    inline ~custom_iterator_template() = default;
 
     // Implicit Cast changeable -> const
-    template<typename T= const custom_iterator_template<TIteratorState,false> &>
-    inline custom_iterator_template(typename std::enable_if<is_const, T>::type source): iteratorState_(source.iteratorState_) {}
+    template<typename T= const custom_iterator_template<TIteratorState, false, TCheckPolicy, TInstrumentation> &>
+    constexpr custom_iterator_template(typename std::enable_if<is_const, T>::type source): generation_type(source), iteratorState_(source.iteratorState_) {
+        this->count(iterator_operation::copy);
+    }
 
     // *** Element Access ***
-    inline element_access_type operator*() { return this->get(); }
-    inline pointer operator->() { return &(operator*()); }
-    element_access_type operator[](difference_type offset) { return at(offset); }
+    constexpr element_access_type operator*() const { return this->get(); }
+    // States implementing `address()` check the connection only: the end address is valid (`std::to_address(end)`)
+    constexpr pointer operator->() const {
+        if constexpr (is_checked) {
+            if constexpr (detail::has_address<TIteratorState<is_const>>::value) {
+                this->check_valid();
+            } else {
+                this->check_dereferenceable();
+            }
+        }
+        this->count(iterator_operation::get);
+        if constexpr (std::is_reference<reference>::value) {
+            return this->address();
+        } else {
+            return pointer(this->state().get());
+        }
+    }
+    constexpr element_access_type operator[](difference_type offset) const { return at(offset); }
+
+
+#if __cplusplus >= 202002L
+    // *** Chunked Access ***
+    // Next batch of up to `max` contiguous elements before `last` (iterator or end marker), the iterator moves behind the batch.
+    // An empty batch marks the end. The batch stays valid as long as an element reference of this iterator category would.
+    // - states implementing `next_chunk()` hand out their own batches (buffered sources, blocks of segmented containers)
+    // - contiguous states return the remaining elements in one batch
+    // - all other forward iterators return one element per batch
+    // `next_chunk()` of non random access states is bounded by the container end only: `last` must be the end there
+    template<typename TLast>
+    constexpr std::span<value_type> next_chunk(const TLast &last, difference_type max) {
+        if constexpr (detail::has_next_chunk<TIteratorState<is_const>>::value) {
+            return this->iteratorState_.next_chunk(this->chunk_size(last, max));
+        } else if constexpr (is_contiguous && !std::is_same<TLast, custom_iterator_sentinel>::value) {
+            const difference_type count = this->chunk_size(last, max);
+            std::span<value_type> chunk(this->address(), static_cast<std::size_t>(count));
+            this->move(count);
+            return chunk;
+        } else {
+            static_assert(std::is_base_of<std::forward_iterator_tag, iterator_concept>::value, "next_chunk() must be defined in input iterator states for chunked access");
+            if (max <= 0 || *this == last) {
+                return {};
+            }
+
+            std::span<value_type> chunk(this->address(), 1);
+            this->next();
+            return chunk;
+        }
+    }
+#endif
 
 
     // *** Increment / Decrement ***
-    inline custom_iterator_template &operator++() {
+    constexpr custom_iterator_template &operator++() {
         this->next();
         return *this;
     }
 
-    inline custom_iterator_template operator++(int) {
-        auto result = *this;
-        this->next();
-        return result;
+    constexpr auto operator++(int) {
+        if constexpr (detail::copies_share_position<TIteratorState<is_const>>::value) {
+            postfix_proxy<typename std::remove_cv<value_type>::type> result{this->get()};
+            this->next();
+            return result;
+        } else {
+            custom_iterator_template result = *this;
+            this->next();
+            return result;
+        }
     }
 
-    inline custom_iterator_template &operator--() {
+    constexpr custom_iterator_template &operator--() {
         this->prev();
         return *this;
     }
 
-    inline custom_iterator_template operator--(int) {
+    constexpr custom_iterator_template operator--(int) {
         auto result = *this;
         this->prev();
         return result;
@@ -80,143 +441,342 @@ struct custom_iterator_template {
 
 
     // *** Random Access ***
-    custom_iterator_template& operator+=(difference_type offset) { move(offset); return *this; }
-    custom_iterator_template& operator-=(difference_type offset) { move(-offset); return *this; }
+    constexpr custom_iterator_template& operator+=(difference_type offset) { move(offset); return *this; }
+    constexpr custom_iterator_template& operator-=(difference_type offset) { move(-offset); return *this; }
 
-    custom_iterator_template operator+(difference_type offset) {
+    constexpr custom_iterator_template operator+(difference_type offset) const {
         custom_iterator_template result = *this;
         result += offset;
         return result;
     }
 
-    friend custom_iterator_template operator + (difference_type offset, const custom_iterator_template &rhs) {
+    friend constexpr custom_iterator_template operator + (difference_type offset, const custom_iterator_template &rhs) {
         custom_iterator_template result = rhs;
         result += offset;
         return result;
     }
 
-    custom_iterator_template operator-(difference_type offset) const {
+    constexpr custom_iterator_template operator-(difference_type offset) const {
         custom_iterator_template result = *this;
         result -= offset;
         return result;
     }
 
 
-    difference_type operator-(const custom_iterator_template& rhs) const { return distance(rhs); }
+    // Distance to const and changeable iterators (mutual sized sentinels)
+    constexpr difference_type operator-(const custom_iterator_template<TIteratorState, true, TCheckPolicy, TInstrumentation> & rhs) const { return distance(rhs); }
+    constexpr difference_type operator-(const custom_iterator_template<TIteratorState, false, TCheckPolicy, TInstrumentation> & rhs) const { return distance(rhs); }
 
 
     // *** Comparison with const and changeable iterators ***
-    inline bool operator!=(const custom_iterator_template<TIteratorState, true> &other) const {
+    constexpr bool operator!=(const custom_iterator_template<TIteratorState, true, TCheckPolicy, TInstrumentation> &other) const {
         return !this->is_equal(other);
     }
 
-    inline bool operator!=(const custom_iterator_template<TIteratorState, false> &other) const {
+    constexpr bool operator!=(const custom_iterator_template<TIteratorState, false, TCheckPolicy, TInstrumentation> &other) const {
         return !this->is_equal(other);
     }
 
-    inline bool operator==(const custom_iterator_template<TIteratorState, true> &other) const {
+    constexpr bool operator==(const custom_iterator_template<TIteratorState, true, TCheckPolicy, TInstrumentation> &other) const {
         return this->is_equal(other);
     }
 
-    inline bool operator==(const custom_iterator_template<TIteratorState, false> &other) const {
+    constexpr bool operator==(const custom_iterator_template<TIteratorState, false, TCheckPolicy, TInstrumentation> &other) const {
         return this->is_equal(other);
     }
 
 
+    // *** Comparison with the end marker - only for states implementing `is_end()` ***
+    template<typename T = TIteratorState<is_const>, typename std::enable_if<detail::has_is_end<T>::value, int>::type = 0>
+    friend constexpr bool operator==(const custom_iterator_template &lhs, custom_iterator_sentinel) {
+        return lhs.state().is_end();
+    }
+
+    template<typename T = TIteratorState<is_const>, typename std::enable_if<detail::has_is_end<T>::value, int>::type = 0>
+    friend constexpr bool operator==(custom_iterator_sentinel, const custom_iterator_template &rhs) {
+        return rhs.state().is_end();
+    }
+
+    template<typename T = TIteratorState<is_const>, typename std::enable_if<detail::has_is_end<T>::value, int>::type = 0>
+    friend constexpr bool operator!=(const custom_iterator_template &lhs, custom_iterator_sentinel) {
+        return !lhs.state().is_end();
+    }
+
+    template<typename T = TIteratorState<is_const>, typename std::enable_if<detail::has_is_end<T>::value, int>::type = 0>
+    friend constexpr bool operator!=(custom_iterator_sentinel, const custom_iterator_template &rhs) {
+        return !rhs.state().is_end();
+    }
+
+
     // *** Relations with const and changeable iterators ***
-    inline bool operator<(const custom_iterator_template<TIteratorState, false> &other) const {
+    constexpr bool operator<(const custom_iterator_template<TIteratorState, true, TCheckPolicy, TInstrumentation> &other) const {
+        return this->distance(other) < 0;
+    }
+
+    constexpr bool operator<(const custom_iterator_template<TIteratorState, false, TCheckPolicy, TInstrumentation> &other) const {
         return this->distance(other) < 0;
     }
 
-    inline bool operator<=(const custom_iterator_template<TIteratorState, false> &other) const {
+    constexpr bool operator<=(const custom_iterator_template<TIteratorState, true, TCheckPolicy, TInstrumentation> &other) const {
+        return this->distance(other) <= 0;
+    }
+
+    constexpr bool operator<=(const custom_iterator_template<TIteratorState, false, TCheckPolicy, TInstrumentation> &other) const {
         return this->distance(other) <= 0;
     }
 
-    inline bool operator>(const custom_iterator_template<TIteratorState, false> &other) const {
+    constexpr bool operator>(const custom_iterator_template<TIteratorState, true, TCheckPolicy, TInstrumentation> &other) const {
         return this->distance(other) > 0;
     }
 
-    inline bool operator>=(const custom_iterator_template<TIteratorState, false> &other) const {
+    constexpr bool operator>(const custom_iterator_template<TIteratorState, false, TCheckPolicy, TInstrumentation> &other) const {
+        return this->distance(other) > 0;
+    }
+
+    constexpr bool operator>=(const custom_iterator_template<TIteratorState, true, TCheckPolicy, TInstrumentation> &other) const {
+        return this->distance(other) >= 0;
+    }
+
+    constexpr bool operator>=(const custom_iterator_template<TIteratorState, false, TCheckPolicy, TInstrumentation> &other) const {
         return this->distance(other) >= 0;
     }
 
     // Status and Helpers
-    inline bool is_connected() { return this->iteratorState_.is_connected(); }
+    constexpr bool is_connected() const { return this->state().is_connected(); }
 
     // Allow access for the corresponding changeable/const implementation
-    friend class custom_iterator_template<TIteratorState, !is_const>;
+    friend struct custom_iterator_template<TIteratorState, !is_const, TCheckPolicy, TInstrumentation>;
+
+    // Allow state access for extensions
+    friend struct custom_iterator_access;
 
 private:
+    typedef TIteratorState<is_const> state_type;
+    typedef detail::recorded_generation<TCheckPolicy::enabled && detail::has_generation<state_type>::value> generation_type;
+    typedef detail::instrumented_copies<TInstrumentation, custom_iterator_template> copies_type;
+
+    static constexpr bool is_checked = TCheckPolicy::enabled;
+
+    // Pointer backed states of unchecked, uninstrumented iterators collapse to their element pointer
+    static constexpr bool is_collapsed = !is_checked && !TInstrumentation::enabled && detail::collapses_to_pointer<state_type>::value && detail::declares_address<state_type>::value &&
+        !detail::has_is_end<state_type>::value && !detail::has_next_chunk<state_type>::value;
+    typedef typename std::conditional<is_collapsed, detail::pointer_state<TIteratorState, is_const>, state_type>::type storage_type;
+
+    static_assert(!detail::collapses_to_pointer<state_type>::value || detail::has_address<state_type>::value, "address() must be defined in iterator states collapsing to pointers");
+    static_assert(!detail::collapses_to_pointer<state_type>::value || std::is_same<element_access_type, value_type &>::value, "Iterator states collapsing to pointers must not use proxy references");
+    static constexpr bool records_generation = is_checked && detail::has_generation<state_type>::value;
+    static constexpr bool checks_range = is_checked && detail::has_container<state_type>::value;
+    static constexpr bool checks_offset = is_checked && detail::has_index<state_type>::value;
+
+#if __cplusplus >= 202002L
+    static constexpr bool is_contiguous = std::is_base_of<std::contiguous_iterator_tag, iterator_concept>::value;
+    static constexpr bool is_random_access = std::is_base_of<std::random_access_iterator_tag, iterator_concept>::value;
+
+    // Batch size limit of `next_chunk()`, never negative: the distance to `last` bounds random access iterators
+    template<typename TLast>
+    constexpr difference_type chunk_size(const TLast &last, difference_type max) const {
+        if constexpr (is_random_access && !std::is_same<TLast, custom_iterator_sentinel>::value) {
+            const difference_type remaining = -this->distance(last);
+            max = remaining < max ? remaining : max;
+        }
+        return max > 0 ? max : 0;
+    }
+#endif
+
     // Construction with container conenction  - must be implemented in state for all kind of iterators
-    custom_iterator_template(container_type *ref) : iteratorState_(ref) {}
+    constexpr custom_iterator_template(container_type *ref) : iteratorState_(ref) {}
+
+    // Construction at the begin or end position - collapsed iterators take the element pointer of a temporary state
+    template<typename TPosition>
+    constexpr custom_iterator_template(container_type *ref, TPosition position) : iteratorState_(initial_storage(ref, position)) {
+        if constexpr (!is_collapsed) {
+            if constexpr (std::is_same<TPosition, detail::end_position>::value) {
+                this->end();
+            } else {
+                this->begin();
+            }
+        }
+    }
+
+    template<typename TPosition>
+    static constexpr storage_type initial_storage(container_type *ref, TPosition) {
+        if constexpr (!is_collapsed) {
+            return storage_type(ref);
+        } else if constexpr (std::is_same<TPosition, detail::end_position>::value) {
+            return storage_type::at_end(ref);
+        } else {
+            return storage_type::at_begin(ref);
+        }
+    }
 
     // Begin of collection - must be implemented in state for all kind of iterators
-    inline void begin() { this->iteratorState_.begin(); }
+    constexpr void begin() {
+        this->iteratorState_.begin();
+        this->record_generation();
+    }
 
     // Behind end of collection - must be implemented in state for all kind of iterators
-    inline void end() { this->iteratorState_.end(); }
+    constexpr void end() {
+        this->iteratorState_.end();
+        this->record_generation();
+    }
 
     // Move to next element - must be implemented in state for all kind of iterators
-    inline void next() { this->iteratorState_.next(); }
+    constexpr void next() {
+        this->count(iterator_operation::next);
+        this->iteratorState_.next();
+    }
 
     // Element access  - must be implemented in state for all kind of iterators
-    inline element_access_type get() { return this->iteratorState_.get(); }
-    inline const element_access_type get() const { return this->iteratorState_.get(); }
-
-    // Comparison with const iterator - must be implemented in state for all kind of iterators
-    inline bool is_equal(const custom_iterator_template<TIteratorState, true> &other) const {
-        if(!this->iteratorState_.is_connected()) {
-            if( other.iteratorState_.is_connected()) {
-                return false;
-            }
-
-            return true;
+    // The reference is returned as is: proxies are returned by value and must stay assignable
+    constexpr element_access_type get() const {
+        if constexpr (is_checked) {
+            this->check_dereferenceable();
         }
+        this->count(iterator_operation::get);
+        return this->state().get();
+    }
 
-        if(!other.iteratorState_.is_connected() && this->iteratorState_.is_connected()) {
-            return false;
+    // Element address - taken from the state if it implements `address()` (required for contiguous iterators)
+    constexpr value_type * address() const {
+        if constexpr (detail::has_address<TIteratorState<is_const>>::value) {
+            return this->state().address();
+        } else {
+            return &(this->state().get());
         }
+    }
 
-        return this->iteratorState_.is_equal(other.iteratorState_); }
-
-    // Comparison with changeable iterator - must be implemented in state for all kind of iterators
-    inline bool is_equal(const custom_iterator_template<TIteratorState, false> &other) const {
-        if(!this->iteratorState_.is_connected()) {
-            if( other.iteratorState_.is_connected()) {
-                return false;
+    // Comparison with const and changeable iterators - must be implemented in state for all kind of iterators
+    // Checked unconnected iterators are only equal to unconnected iterators, unless the state declares `compares_unconnected`
+    // Unchecked iterators compare the states only
+    template<bool other_is_const>
+    constexpr bool is_equal(const custom_iterator_template<TIteratorState, other_is_const, TCheckPolicy, TInstrumentation> &other) const {
+        if constexpr (is_checked) {
+            if constexpr (!detail::compares_unconnected<TIteratorState<is_const>>::value) {
+                const bool connected = this->state().is_connected();
+                const bool otherConnected = other.state().is_connected();
+                if(!connected || !otherConnected) {
+                    return connected == otherConnected;
+                }
             }
-
-            return true;
-        }
-
-        if(!other.iteratorState_.is_connected() && this->iteratorState_.is_connected()) {
-            return false;
+            this->check_same_container(other, "comparison of iterators of different containers");
         }
+        this->count(iterator_operation::is_equal);
 
-        return this->iteratorState_.is_equal(other.iteratorState_);
+        return this->state().is_equal(other.iteratorState_);
     }
 
     // Move to previous element - must be implemented in state for bidirectional and random access iterators
-    inline void prev() { this->iteratorState_.prev(); }
+    constexpr void prev() {
+        this->count(iterator_operation::prev);
+        this->iteratorState_.prev();
+    }
 
     // Move to arbitrary position - must be implemented in state for random access iterators
-    inline void move(std::ptrdiff_t offset) { this->iteratorState_.move(offset); }
+    constexpr void move(std::ptrdiff_t offset) {
+        if constexpr (checks_offset) {
+            this->check_offset(offset, true, "iterator moved out of range");
+        }
+        this->count(iterator_operation::move);
+        this->iteratorState_.move(offset);
+    }
 
     // Element access at offset - must be implemented in state for random access iterators
-    inline element_access_type at(std::ptrdiff_t offset) { return this->iteratorState_.at(offset); }
-    inline const element_access_type at(std::ptrdiff_t offset) const { return this->iteratorState_.at(offset); }
+    constexpr element_access_type at(std::ptrdiff_t offset) const {
+        if constexpr (is_checked) {
+            this->check_valid();
+            if constexpr (checks_offset) {
+                this->check_offset(offset, false, "element access out of range");
+            }
+        }
+        this->count(iterator_operation::get);
+        return this->state().at(offset);
+    }
 
     // Distance from const iterator - must be implemented in state for random access iterators
-    inline std::ptrdiff_t distance(const custom_iterator_template<TIteratorState, true> & rhs) const {
-        return this->iteratorState_.distance(rhs.iteratorState_);
+    constexpr std::ptrdiff_t distance(const custom_iterator_template<TIteratorState, true, TCheckPolicy, TInstrumentation> & rhs) const {
+        if constexpr (is_checked) {
+            this->check_same_container(rhs, "distance of iterators of different containers");
+        }
+        return this->state().distance(rhs.iteratorState_);
     }
 
     // Distance from changeable iterator - must be implemented in state for random access iterators
-    inline std::ptrdiff_t distance(const custom_iterator_template<TIteratorState, false> & rhs) const {
-        return this->iteratorState_.distance(rhs.iteratorState_);
+    constexpr std::ptrdiff_t distance(const custom_iterator_template<TIteratorState, false, TCheckPolicy, TInstrumentation> & rhs) const {
+        if constexpr (is_checked) {
+            this->check_same_container(rhs, "distance of iterators of different containers");
+        }
+        return this->state().distance(rhs.iteratorState_);
+    }
+
+    // *** Instrumentation - no code for uninstrumented iterators ***
+    static constexpr void count(iterator_operation operation) {
+        if constexpr (TInstrumentation::enabled) {
+            TInstrumentation::template count<custom_iterator_template>(operation);
+        }
+    }
+
+    // *** Checks - instantiated for checked iterators only ***
+    constexpr void record_generation() {
+        if constexpr (records_generation) {
+            if (this->iteratorState_.is_connected()) {
+                this->generation_ = this->iteratorState_.generation();
+            }
+        }
+    }
+
+    // Connected and not invalidated by a container modification
+    constexpr void check_valid() const {
+        if (!this->state().is_connected()) {
+            TCheckPolicy::failed("use of an unconnected iterator");
+        }
+        if constexpr (records_generation) {
+            if (this->generation_ != this->state().generation()) {
+                TCheckPolicy::failed("use of an iterator invalidated by a container modification");
+            }
+        }
+    }
+
+    // Valid and not at the end position - the end test needs `is_end()`: building an end state on every dereference
+    // would run the side effects of the state construction (e.g. connection counting)
+    constexpr void check_dereferenceable() const {
+        this->check_valid();
+        if constexpr (checks_range && detail::has_is_end<state_type>::value) {
+            if (this->state().is_end()) {
+                TCheckPolicy::failed("dereference of the end iterator");
+            }
+        }
+    }
+
+    // Both unconnected or connected to the same container
+    template<bool other_is_const>
+    constexpr void check_same_container(const custom_iterator_template<TIteratorState, other_is_const, TCheckPolicy, TInstrumentation> &other, const char * message) const {
+        if constexpr (detail::has_container<state_type>::value) {
+            if (this->state().is_connected() && other.state().is_connected() &&
+                static_cast<const void *>(this->state().container()) != static_cast<const void *>(other.state().container())) {
+                TCheckPolicy::failed(message);
+            }
+        }
+    }
+
+    // `offset` from the current position within [begin, end] or [begin, end) - taken from `index()` and `size()`:
+    // building begin and end states would run the side effects of the state construction (e.g. connection counting)
+    constexpr void check_offset(std::ptrdiff_t offset, bool end_allowed, const char * message) const {
+        if (!this->state().is_connected()) {
+            TCheckPolicy::failed("use of an unconnected iterator");
+        }
+        const std::ptrdiff_t index = this->state().index();
+        const std::ptrdiff_t remaining = this->state().size() - index;
+        if (offset < -index || offset > remaining || (!end_allowed && offset == remaining)) {
+            TCheckPolicy::failed(message);
+        }
     }
 
-    TIteratorState<is_const> iteratorState_;
+    // Iterators are const like pointers: the hooks are called through const iterators, they need not be const
+    // (no mutable member: mutable members are not readable in constant expressions)
+    constexpr storage_type & state() const { return const_cast<storage_type &>(this->iteratorState_); }
+
+    storage_type iteratorState_;
 };
 
 } // namespace foundation
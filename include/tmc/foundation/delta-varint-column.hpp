@@ -0,0 +1,343 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_delta_varint_column_hpp_
+#define _tmc_foundation_delta_varint_column_hpp_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "custom-iterator-template.hpp"
+#include "custom-iterator-template-helper.hpp"
+
+// Sorted column of `std::uint64_t` values, compressed in blocks of `BlockSize` values: the first value of a block is kept
+// uncompressed in the block table (the skip metadata), the following values are stored as LEB128 varint deltas to their
+// predecessor. Dense sorted ids take about one byte per value instead of eight.
+// The forward iterators decode `delta_varint_chunk` values at a time into a buffer inside the iterator state (about 200
+// bytes per iterator, independent of `BlockSize`), `lower_bound()` binary searches the block table and decodes the block
+// of the result up to the result only.
+//
+//   tmc::foundation::delta_varint_column<> ids(sortedIds.begin(), sortedIds.end());
+//   for (auto i = ids.lower_bound(first), end = ids.end(); i != end && *i < last; ++i) { ... }
+
+namespace tmc {
+namespace foundation {
+
+template<std::size_t BlockSize>
+class delta_varint_column;
+
+namespace detail {
+
+    // Appends `value` in 7 bit groups, least significant first, the high bit marks a following byte
+    inline void varint_encode(std::uint64_t value, std::vector<std::uint8_t> &bytes) {
+        while (value >= 0x80) {
+            bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        bytes.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    // Decodes the varint at `bytes` and moves `bytes` behind it
+    inline std::uint64_t varint_decode(const std::uint8_t *&bytes) {
+        std::uint64_t value = *bytes++;
+        if (value < 0x80) {
+            // One byte deltas of dense ids
+            return value;
+        }
+
+        value &= 0x7f;
+        for (unsigned shift = 7;; shift += 7) {
+            const std::uint64_t byte = *bytes++;
+            value |= (byte & 0x7f) << shift;
+            if (byte < 0x80) {
+                return value;
+            }
+        }
+    }
+
+    // Decodes `count` deltas at `bytes` into running values starting from `value`, moves `bytes` and `value` behind them
+    // Groups of eight deltas: one byte deltas at once if no high bit is set in the next eight bytes (present as each
+    // delta has a byte), longer deltas one by one
+    inline void varint_decode_deltas(const std::uint8_t *&bytes, std::uint64_t &value, std::uint64_t *values, std::size_t count) {
+        std::size_t index = 0;
+        for (; count - index >= 8; index += 8) {
+            std::uint64_t group;
+            std::memcpy(&group, bytes, sizeof(group));
+            if ((group & 0x8080808080808080ull) == 0) {
+                for (std::size_t lane = 0; lane < 8; ++lane) {
+                    value += bytes[lane];
+                    values[index + lane] = value;
+                }
+                bytes += 8;
+            } else {
+                for (std::size_t lane = 0; lane < 8; ++lane) {
+                    value += varint_decode(bytes);
+                    values[index + lane] = value;
+                }
+            }
+        }
+
+        for (; index < count; ++index) {
+            value += varint_decode(bytes);
+            values[index] = value;
+        }
+    }
+
+} // namespace detail
+
+// Values decoded at a time by the iterators of `delta_varint_column` - the buffer size of the iterator states, the states
+// are copied with the iterators (e.g. into the std algorithms)
+inline constexpr std::size_t delta_varint_chunk = 16;
+
+// Iterator state of `delta_varint_column<BlockSize>` - a decoded chunk of the block of the current position
+// The values are read only: both variants return `std::uint64_t` values (references would dangle when the buffer moves on).
+template<std::size_t BlockSize, bool is_const>
+struct delta_varint_state {
+    typedef std::forward_iterator_tag iterator_category;
+    typedef typename std::conditional<is_const, const delta_varint_column<BlockSize>, delta_varint_column<BlockSize>>::type container_type;
+    typedef const std::uint64_t value_type;
+    typedef std::uint64_t reference;
+
+    static constexpr std::size_t chunk_size = BlockSize < delta_varint_chunk ? BlockSize : delta_varint_chunk;
+
+    // Unconnected states are at block `~0`, connected states stay in [0, block_count()]
+    static constexpr bool compares_unconnected = true;
+
+    container_type * container_{nullptr};
+    std::size_t block_{~std::size_t{0}};
+    // Position in the block of `buffer_[0]`, `buffer_[position_]` is the current value
+    std::size_t base_{0};
+    std::size_t position_{0};
+    std::size_t count_{0};
+    // Values of the block behind the buffer, their deltas start at `bytes_`
+    std::size_t remaining_{0};
+    const std::uint8_t *bytes_{nullptr};
+    std::uint64_t buffer_[chunk_size]{};
+
+    // Default Construction without container connection (ALL Iterators)
+    inline delta_varint_state() = default;
+
+    // Construction with connected container (ALL Iterators)
+    inline delta_varint_state(container_type * container): container_(container) {}
+
+    // Copy Construction - defaulted to keep the state trivially copyable (ALL Iterators)
+    inline delta_varint_state(const delta_varint_state & source) = default;
+
+    // Copy Construction from the changeable variant (ALL Iterators)
+    template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+    inline delta_varint_state(const delta_varint_state<BlockSize, other_is_const> & source):
+        container_(source.container_), block_(source.block_), base_(source.base_), position_(source.position_), count_(source.count_),
+        remaining_(source.remaining_), bytes_(source.bytes_) {
+        std::copy(source.buffer_, source.buffer_ + source.count_, buffer_);
+    }
+
+    // Start and End Positions (ALL Iterators)
+    inline void begin() { load(0); }
+
+    inline void end() {
+        block_ = container_->block_count();
+        base_ = position_ = count_ = remaining_ = 0;
+    }
+
+    // Availability and Equality (ALL Iterators)
+    inline bool is_connected() const { return container_ != nullptr; }
+
+    template<bool other_is_const>
+    inline bool is_equal(const delta_varint_state<BlockSize, other_is_const> & other) const {
+        return block_ == other.block_ && base_ + position_ == other.base_ + other.position_;
+    }
+
+    // Move Next (ALL Iterators)
+    inline void next() {
+        if (++position_ == count_) {
+            refill();
+        }
+    }
+
+    // Element Access (ALL Iterators)
+    inline reference get() const { return buffer_[position_]; }
+
+    // Move to the first value of `block`, the end position behind the last block (Compressed Columns)
+    inline void load(std::size_t block) {
+        block_ = block;
+        base_ = position_ = 0;
+        if (block >= container_->block_count()) {
+            count_ = remaining_ = 0;
+            return;
+        }
+
+        const auto &header = container_->blocks_[block];
+        std::uint64_t value = header.first;
+        bytes_ = container_->bytes_.data() + header.offset;
+        buffer_[0] = value;
+        const std::size_t values = container_->block_values(block);
+        count_ = std::min(chunk_size, values);
+        remaining_ = values - count_;
+        detail::varint_decode_deltas(bytes_, value, buffer_ + 1, count_ - 1);
+    }
+
+    // Decodes the next chunk of the block, moves to the next block behind the last chunk (Compressed Columns)
+    inline void refill() {
+        if (remaining_ == 0) {
+            load(block_ + 1);
+            return;
+        }
+
+        std::uint64_t value = buffer_[count_ - 1];
+        base_ += count_;
+        position_ = 0;
+        count_ = std::min(chunk_size, remaining_);
+        remaining_ -= count_;
+        detail::varint_decode_deltas(bytes_, value, buffer_, count_);
+    }
+
+    // Modification count of the column - appends may move the bytes behind `bytes_` (Checked Iterators)
+    inline std::size_t generation() const { return container_->generation_; }
+
+    // Move forward to the first value not less than `value`: whole blocks are skipped by their first values, the block
+    // of the result is decoded up to the chunk of the result (Compressed Columns)
+    inline void seek(std::uint64_t value) {
+        if (position_ == count_) {
+            return;
+        }
+
+        const std::size_t block = container_->lower_bound_block(block_, value);
+        if (block != block_) {
+            load(block);
+        }
+
+        // Ends at the first value of the next block at the latest
+        for (;;) {
+            const std::uint64_t *found = std::lower_bound(buffer_ + position_, buffer_ + count_, value);
+            position_ = static_cast<std::size_t>(found - buffer_);
+            if (position_ != count_) {
+                return;
+            }
+            refill();
+            if (count_ == 0) {
+                return;
+            }
+        }
+    }
+};
+
+// Sorted `std::uint64_t` column compressed in blocks of `BlockSize` delta encoded varints, append only
+template<std::size_t BlockSize = 128>
+class delta_varint_column {
+    static_assert(BlockSize > 0, "Blocks must hold values");
+
+    template<bool is_const>
+    using iterator_state = delta_varint_state<BlockSize, is_const>;
+
+    template<std::size_t, bool>
+    friend struct delta_varint_state;
+
+    public:
+    typedef std::uint64_t value_type;
+    typedef std::size_t size_type;
+
+    static constexpr std::size_t block_size = BlockSize;
+
+    // Skip metadata of a block: its first value and the offset of the deltas of the following values
+    struct block_header {
+        std::uint64_t first;
+        std::size_t offset;
+    };
+
+    inline delta_varint_column() = default;
+
+    template<typename TInputIterator>
+    delta_varint_column(TInputIterator first, TInputIterator last) {
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+
+    delta_varint_column(std::initializer_list<std::uint64_t> values): delta_varint_column(values.begin(), values.end()) {}
+
+    // Appends `value`, throws `std::invalid_argument` if it is less than the last value
+    void push_back(std::uint64_t value) {
+        if (size_ != 0 && value < last_) {
+            throw std::invalid_argument("delta_varint_column values must be sorted");
+        }
+
+        if (size_ % BlockSize == 0) {
+            blocks_.push_back(block_header{value, bytes_.size()});
+        } else {
+            detail::varint_encode(value - last_, bytes_);
+        }
+        last_ = value;
+        ++size_;
+        ++generation_;
+    }
+
+    void clear() {
+        bytes_.clear();
+        blocks_.clear();
+        size_ = 0;
+        ++generation_;
+    }
+
+    void shrink_to_fit() {
+        bytes_.shrink_to_fit();
+        blocks_.shrink_to_fit();
+        ++generation_;
+    }
+
+    inline std::size_t size() const { return size_; }
+    inline bool empty() const { return size_ == 0; }
+    inline std::size_t block_count() const { return blocks_.size(); }
+    inline const std::vector<block_header> & blocks() const { return blocks_; }
+
+    // Bytes of the varints and the block table
+    inline std::size_t size_bytes() const { return bytes_.size() + blocks_.size() * sizeof(block_header); }
+
+    SETUP_RANGE_ITERATORS(iterator_state);
+
+    // First value not less than `value`, decodes one block
+    const_iterator lower_bound(std::uint64_t value) const {
+        const_iterator result = const_iterator::end(this);
+        if (!empty()) {
+            auto &state = custom_iterator_access::state(result);
+            state.load(lower_bound_block(0, value));
+            state.seek(value);
+        }
+        return result;
+    }
+
+    // First value not less than `value` at or behind `from`: the forward seek of merges and intersections
+    const_iterator lower_bound(const_iterator from, std::uint64_t value) const {
+        custom_iterator_access::state(from).seek(value);
+        return from;
+    }
+
+    private:
+    // Last block from `block` on whose first value is less than `value` - holds the lower bound unless it is the first
+    // value of the next block
+    inline std::size_t lower_bound_block(std::size_t block, std::uint64_t value) const {
+        const auto found = std::lower_bound(blocks_.begin() + static_cast<std::ptrdiff_t>(block) + 1, blocks_.end(), value,
+                                            [](const block_header &header, std::uint64_t searched) { return header.first < searched; });
+        return static_cast<std::size_t>(found - blocks_.begin()) - 1;
+    }
+
+    // Values of `block`
+    inline std::size_t block_values(std::size_t block) const { return std::min(BlockSize, size_ - block * BlockSize); }
+
+    std::vector<std::uint8_t> bytes_;
+    std::vector<block_header> blocks_;
+    std::uint64_t last_{0};
+    std::size_t size_{0};
+    // Modification count - `push_back()`, `clear()` and `shrink_to_fit()` may move the bytes
+    std::size_t generation_{0};
+};
+
+} // namespace foundation
+}  // namespace tmc
+
+#endif
@@ -0,0 +1,237 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_fd_input_iterator_hpp_
+#define _tmc_foundation_fd_input_iterator_hpp_
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <unistd.h>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+#include "custom-iterator-template.hpp"
+#include "custom-iterator-template-helper.hpp"
+
+// Buffered input iterators over file descriptors (POSIX) - pipes, sockets, files that cannot be mapped
+// The range owns one aligned buffer, refilled with `read()` when the elements are consumed. The iterators only
+// point to the range: copies share the buffer and the position, `it++` returns a proxy holding the old element.
+// Elements split by a `read()` are completed by the next one. The file descriptor is not owned, blocking reads are expected.
+//
+//   tmc::foundation::fd_input_range<Record, 65536> records(STDIN_FILENO);
+//   for (const Record &record: records) { ... }
+
+namespace tmc {
+namespace foundation {
+
+// Buffer size argument of `fd_input_range` for a buffer size given at runtime
+inline constexpr std::size_t dynamic_buffer_size = 0;
+
+// Alignment of the input buffer (cache line)
+inline constexpr std::size_t fd_buffer_alignment = 64;
+
+template<typename T, std::size_t BufferSize = dynamic_buffer_size>
+class fd_input_range;
+
+namespace detail {
+
+    // Compile time buffer size - the buffer is part of the range object, no allocation
+    template<std::size_t BufferSize>
+    struct fd_buffer {
+        inline fd_buffer() = default;
+        inline explicit fd_buffer(std::size_t) {}
+
+        inline unsigned char * buffer() { return buffer_; }
+        static constexpr std::size_t capacity() { return BufferSize; }
+
+        alignas(fd_buffer_alignment) unsigned char buffer_[BufferSize];
+    };
+
+    // Runtime buffer size - one aligned allocation for the lifetime of the range
+    template<>
+    struct fd_buffer<dynamic_buffer_size> {
+        struct aligned_delete {
+            inline void operator()(unsigned char *buffer) const { ::operator delete[](buffer, std::align_val_t{fd_buffer_alignment}); }
+        };
+
+        inline explicit fd_buffer(std::size_t capacity):
+            buffer_(static_cast<unsigned char *>(::operator new[](capacity, std::align_val_t{fd_buffer_alignment}))), capacity_(capacity) {}
+
+        inline unsigned char * buffer() { return buffer_.get(); }
+        inline std::size_t capacity() const { return capacity_; }
+
+        std::unique_ptr<unsigned char[], aligned_delete> buffer_;
+        std::size_t capacity_;
+    };
+
+} // namespace detail
+
+// Iterator state of `fd_input_range<T, BufferSize>` - a pointer to the range, which holds buffer and position
+// Unconnected states are at the end, like `std::istreambuf_iterator`: `end()` needs no container access
+template<typename T, std::size_t BufferSize, bool is_const>
+struct fd_input_state {
+    typedef std::input_iterator_tag iterator_category;
+    typedef fd_input_range<T, BufferSize> container_type;
+    typedef typename std::conditional<is_const, const T, T>::type value_type;
+
+    // Iterators are equal if both are at the end or both are not (single pass)
+    static constexpr bool compares_unconnected = true;
+
+    // All copies read from the range position
+    static constexpr bool copies_share_position = true;
+
+    container_type * container_{nullptr};
+
+    // Default Construction without container connection (ALL Iterators)
+    inline fd_input_state() = default;
+
+    // Construction with connected container (ALL Iterators)
+    inline fd_input_state(container_type * container): container_(container) {}
+
+    // Copy Construction - defaulted, copies do not duplicate the buffer (ALL Iterators)
+    inline fd_input_state(const fd_input_state & source) = default;
+
+    // Start and End Positions - the range reads on the first access, end states are unconnected (ALL Iterators)
+    inline void begin() {}
+    inline void end() { container_ = nullptr; }
+
+    // Availability and Equality - refills the buffer if it holds no complete element (ALL Iterators)
+    inline bool is_connected() const { return container_ != nullptr; }
+
+    template<bool other_is_const>
+    inline bool is_equal(const fd_input_state<T, BufferSize, other_is_const> & other) const { return at_end() == other.at_end(); }
+
+    inline bool at_end() const { return container_ == nullptr || container_->at_end(); }
+
+    // Move Next (ALL Iterators)
+    inline void next() { container_->advance(); }
+
+    // Element Access (ALL Iterators)
+    inline value_type & get() const { return container_->current(); }
+
+#if __cplusplus >= 202002L
+    // Chunked Access - the complete elements in the buffer, refilled before a batch, never while a batch is in use
+    inline std::span<value_type> next_chunk(std::ptrdiff_t max) { return container_->next_chunk(max); }
+#endif
+};
+
+// Single pass range over the elements of type `T` read from a file descriptor
+// `BufferSize` (bytes) is a compile time constant or `dynamic_buffer_size` for a buffer size given to the constructor.
+// Failing reads throw `std::system_error`, interrupted reads are repeated. A trailing incomplete element is ignored.
+template<typename T, std::size_t BufferSize>
+class fd_input_range: detail::fd_buffer<BufferSize> {
+    static_assert(std::is_trivially_copyable<T>::value, "Elements must be trivially copyable to be read from a file descriptor");
+    static_assert(BufferSize == dynamic_buffer_size || BufferSize >= sizeof(T), "The buffer must hold at least one element");
+    static_assert(alignof(T) <= fd_buffer_alignment, "Element alignment exceeds the buffer alignment");
+
+    template<bool is_const>
+    using iterator_state = fd_input_state<T, BufferSize, is_const>;
+
+    template<typename, std::size_t, bool>
+    friend struct fd_input_state;
+
+    public:
+    typedef T value_type;
+
+    // Compile time buffer size
+    template<std::size_t S = BufferSize, typename std::enable_if<S != dynamic_buffer_size, int>::type = 0>
+    inline explicit fd_input_range(int fd): fd_(fd) {}
+
+    // Runtime buffer size in bytes
+    template<std::size_t S = BufferSize, typename std::enable_if<S == dynamic_buffer_size, int>::type = 0>
+    inline fd_input_range(int fd, std::size_t bufferSize): detail::fd_buffer<BufferSize>(checked_buffer_size(bufferSize)), fd_(fd) {}
+
+    // The iterators point to the range
+    fd_input_range(const fd_input_range &) = delete;
+    fd_input_range & operator=(const fd_input_range &) = delete;
+
+    inline int fd() const { return fd_; }
+    inline std::size_t buffer_size() const { return this->capacity(); }
+
+    // Number of `read()` calls so far
+    inline std::size_t read_count() const { return readCount_; }
+
+    // Single pass: no const iteration
+    SETUP_MUTABLE_ITERATOR(iterator_state);
+
+    private:
+    static std::size_t checked_buffer_size(std::size_t bufferSize) {
+        if (bufferSize < sizeof(T)) {
+            throw std::invalid_argument("The buffer must hold at least one element");
+        }
+        return bufferSize;
+    }
+
+    inline bool at_end() {
+        if (last_ - first_ < sizeof(T)) {
+            fill();
+        }
+        return last_ - first_ < sizeof(T);
+    }
+
+    // Dereferencing without a preceding end check reads too, the element is undefined at the end
+    inline T & current() {
+        if (last_ - first_ < sizeof(T)) {
+            fill();
+        }
+        return *reinterpret_cast<T *>(this->buffer() + first_);
+    }
+
+    inline void advance() { first_ += sizeof(T); }
+
+#if __cplusplus >= 202002L
+    inline std::span<T> next_chunk(std::ptrdiff_t max) {
+        if (max <= 0 || at_end()) {
+            return {};
+        }
+
+        const std::size_t count = std::min(static_cast<std::size_t>(max), (last_ - first_) / sizeof(T));
+        std::span<T> chunk(&current(), count);
+        first_ += count * sizeof(T);
+        return chunk;
+    }
+#endif
+
+    // Moves the incomplete element to the front and reads until the buffer holds a complete element or the input ends
+    // Elements stay at multiples of `sizeof(T)` from the aligned buffer start
+    void fill() {
+        unsigned char *buffer = this->buffer();
+        const std::size_t remaining = last_ - first_;
+        if (remaining > 0 && first_ > 0) {
+            std::memmove(buffer, buffer + first_, remaining);
+        }
+        first_ = 0;
+        last_ = remaining;
+
+        while (!eof_ && last_ < sizeof(T)) {
+            const ssize_t count = ::read(fd_, buffer + last_, this->capacity() - last_);
+            ++readCount_;
+            if (count > 0) {
+                last_ += static_cast<std::size_t>(count);
+            } else if (count == 0) {
+                eof_ = true;
+            } else if (errno != EINTR) {
+                throw std::system_error(errno, std::generic_category(), "read");
+            }
+        }
+    }
+
+    int fd_;
+    std::size_t first_{0};
+    std::size_t last_{0};
+    std::size_t readCount_{0};
+    bool eof_{false};
+};
+
+} // namespace foundation
+}  // namespace tmc
+
+#endif
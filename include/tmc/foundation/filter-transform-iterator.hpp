@@ -0,0 +1,337 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_filter_transform_iterator_hpp_
+#define _tmc_foundation_filter_transform_iterator_hpp_
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "custom-iterator-template.hpp"
+#include "custom-iterator-template-helper.hpp"
+
+// Lazy filter and transform adapters over the iterator states of custom containers - no intermediate containers
+// - `make_filter_range(container, predicate)` skips the elements failing `predicate`
+// - `make_transform_range(container, function)` yields `function(element)`
+// Adapters of adapters fuse at compile time: the stages are appended to one `adapter_state` over the source state, an
+// element runs through all stages in one call chain, there are no nested adapter states.
+// Filter pipelines evaluate the stages once per element when the iterator moves and cache the result, the element access
+// and the comparisons do not call the stages again. Transform only pipelines call the functions on element access.
+// The stages are called as const, the adapter ranges are views referencing the source container; the iterators reference
+// the adapter range (its stages) and must not outlive it.
+//
+//   auto evens = tmc::foundation::make_filter_range(container, [](int value) { return value % 2 == 0; });
+//   for (int square: tmc::foundation::make_transform_range(evens, [](int value) { return value * value; })) { ... }
+
+namespace tmc {
+namespace foundation {
+
+// Stage skipping the elements failing `predicate_`
+template<typename TPredicate>
+struct filter_stage {
+    TPredicate predicate_;
+};
+
+// Stage replacing the elements by `function_(element)`
+template<typename TFunction>
+struct transform_stage {
+    TFunction function_;
+};
+
+template<template<bool> typename TIteratorState, bool is_const_source, typename TStages>
+class adapter_range;
+
+namespace detail {
+
+    template<typename TStage>
+    struct is_filter_stage: std::false_type {};
+
+    template<typename TPredicate>
+    struct is_filter_stage<filter_stage<TPredicate>>: std::true_type {};
+
+    template<typename TStages>
+    struct has_filter_stage;
+
+    template<typename... TStages>
+    struct has_filter_stage<std::tuple<TStages...>>: std::disjunction<is_filter_stage<TStages>...> {};
+
+    // Element access type after the stages: filters keep it, transforms replace it by their result
+    template<typename TReference, typename... TStages>
+    struct stage_result {
+        typedef TReference type;
+    };
+
+    template<typename TReference, typename TPredicate, typename... TStages>
+    struct stage_result<TReference, filter_stage<TPredicate>, TStages...>: stage_result<TReference, TStages...> {};
+
+    template<typename TReference, typename TFunction, typename... TStages>
+    struct stage_result<TReference, transform_stage<TFunction>, TStages...>: stage_result<std::invoke_result_t<const TFunction &, TReference>, TStages...> {};
+
+    template<typename TReference, typename TStages>
+    struct pipeline_result;
+
+    // Lvalue references are passed through, all other results are values
+    template<typename TReference, typename... TStages>
+    struct pipeline_result<TReference, std::tuple<TStages...>> {
+        typedef typename stage_result<TReference, TStages...>::type result_type;
+        typedef typename std::conditional<std::is_lvalue_reference<result_type>::value, result_type, std::remove_cv_t<std::remove_reference_t<result_type>>>::type type;
+    };
+
+    // Result cache of filter pipelines: the element address for references, the value otherwise
+    template<typename TReference, bool is_reference = std::is_lvalue_reference<TReference>::value>
+    struct adapter_cache {
+        std::optional<TReference> value_;
+
+        template<typename TValue>
+        inline void set(TValue && value) { value_.emplace(std::forward<TValue>(value)); }
+        inline TReference get() const { return *value_; }
+    };
+
+    template<typename TReference>
+    struct adapter_cache<TReference, true> {
+        std::remove_reference_t<TReference> * value_{nullptr};
+
+        inline void set(TReference value) { value_ = &value; }
+        inline TReference get() const { return *value_; }
+    };
+
+    // End of the source and result cache of filter pipelines - filters stop at the end, empty for transform only pipelines
+    template<typename TSourceState, typename TReference, bool is_filtered>
+    struct adapter_filter {
+        inline adapter_filter() = default;
+        inline explicit adapter_filter(typename TSourceState::container_type * source): last_(source) {}
+
+        TSourceState last_;
+        adapter_cache<TReference> cache_;
+    };
+
+    template<typename TSourceState, typename TReference>
+    struct adapter_filter<TSourceState, TReference, false> {
+        inline adapter_filter() = default;
+        inline explicit adapter_filter(typename TSourceState::container_type *) {}
+    };
+
+    // Adapter range type over the source container iterated by `TIterator`
+    template<typename TIterator, typename TStages>
+    struct adapter_range_of;
+
+    template<template<bool> typename TIteratorState, bool is_const, typename TCheckPolicy, typename TInstrumentation, typename TStages>
+    struct adapter_range_of<custom_iterator_template<TIteratorState, is_const, TCheckPolicy, TInstrumentation>, TStages> {
+        typedef adapter_range<TIteratorState, is_const, TStages> type;
+    };
+
+    template<typename TContainer>
+    struct is_adapter_range: std::false_type {};
+
+    template<template<bool> typename TIteratorState, bool is_const_source, typename TStages>
+    struct is_adapter_range<adapter_range<TIteratorState, is_const_source, TStages>>: std::true_type {};
+
+} // namespace detail
+
+// Iterator state of `adapter_range` - the source state and the stages fused into one state
+// Filter pipelines are forward iterators (input iterators over input sources), transform only pipelines keep the source
+// category up to random access.
+template<template<bool> typename TIteratorState, bool is_const_source, typename TStages, bool is_const>
+struct adapter_state:
+    detail::adapter_filter<TIteratorState<is_const_source || is_const>, typename detail::pipeline_result<typename detail::state_reference<TIteratorState<is_const_source || is_const>>::type, TStages>::type, detail::has_filter_stage<TStages>::value> {
+
+    typedef TIteratorState<is_const_source || is_const> source_state;
+    typedef typename detail::state_reference<source_state>::type source_reference;
+
+    static constexpr std::size_t stage_count = std::tuple_size<TStages>::value;
+    static constexpr bool is_filtered = detail::has_filter_stage<TStages>::value;
+
+    typedef detail::legacy_iterator_category<typename source_state::iterator_category> source_category;
+    typedef typename std::conditional<is_filtered,
+        typename std::common_type<source_category, std::forward_iterator_tag>::type,
+        typename std::common_type<source_category, std::random_access_iterator_tag>::type>::type iterator_category;
+    typedef typename std::conditional<is_const, const adapter_range<TIteratorState, is_const_source, TStages>, adapter_range<TIteratorState, is_const_source, TStages>>::type container_type;
+    typedef typename detail::pipeline_result<source_reference, TStages>::type reference;
+    typedef typename std::remove_reference<reference>::type value_type;
+    typedef detail::adapter_filter<source_state, reference, is_filtered> filter_type;
+
+    static constexpr bool compares_unconnected = detail::compares_unconnected<source_state>::value;
+
+    container_type * container_{nullptr};
+    source_state source_;
+
+    // Default Construction without container connection (ALL Iterators)
+    inline adapter_state() = default;
+
+    // Construction with connected container (ALL Iterators)
+    inline adapter_state(container_type * container): filter_type(container->source()), container_(container), source_(container->source()) {}
+
+    // Copy Construction from the changeable variant - filter pipelines evaluate the stages again for the const elements (ALL Iterators)
+    template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+    inline adapter_state(const adapter_state<TIteratorState, is_const_source, TStages, other_is_const> & source):
+        container_(source.container_), source_(source.source_) {
+        if constexpr (is_filtered) {
+            this->last_ = source.last_;
+            if (container_ != nullptr && !source_.is_equal(this->last_)) {
+                pass<0>(source_.get());
+            }
+        }
+    }
+
+    // Start and End Positions - filters move to the first passing element (ALL Iterators)
+    inline void begin() {
+        source_.begin();
+        if constexpr (is_filtered) {
+            this->last_.end();
+            seek();
+        }
+    }
+
+    inline void end() {
+        source_.end();
+        if constexpr (is_filtered) {
+            this->last_.end();
+        }
+    }
+
+    // Availability and Equality (ALL Iterators)
+    inline bool is_connected() const { return container_ != nullptr; }
+
+    template<bool other_is_const>
+    inline bool is_equal(const adapter_state<TIteratorState, is_const_source, TStages, other_is_const> & other) const { return source_.is_equal(other.source_); }
+
+    // Move Next - filters move to the next passing element (ALL Iterators)
+    inline void next() {
+        source_.next();
+        if constexpr (is_filtered) {
+            seek();
+        }
+    }
+
+    // Element Access - the cached result of filter pipelines, the transformed source element otherwise (ALL Iterators)
+    inline reference get() {
+        if constexpr (is_filtered) {
+            return this->cache_.get();
+        } else {
+            return transformed<0>(source_.get());
+        }
+    }
+
+    // Move Previous (Bidirectional, Random Access Iterators - transform only pipelines)
+    // Disabled for filter pipelines: the source positions would skip the filter, `--it`, `it += n`, `it[n]` and `last - first`
+    // do not compile for their iterators
+    template<bool filtered = is_filtered, typename std::enable_if<!filtered, int>::type = 0>
+    inline void prev() { source_.prev(); }
+
+    // Move to position (Random Access Iterators - transform only pipelines)
+    template<bool filtered = is_filtered, typename std::enable_if<!filtered, int>::type = 0>
+    inline void move(std::ptrdiff_t offset) { source_.move(offset); }
+
+    // Calculate Distance (Random Access Iterators - transform only pipelines)
+    template<bool other_is_const, bool filtered = is_filtered, typename std::enable_if<!filtered, int>::type = 0>
+    inline std::ptrdiff_t distance(const adapter_state<TIteratorState, is_const_source, TStages, other_is_const> & rhs) const { return source_.distance(rhs.source_); }
+
+    // Element access at position (Random Access Iterators - transform only pipelines)
+    template<bool filtered = is_filtered, typename std::enable_if<!filtered, int>::type = 0>
+    inline reference at(std::ptrdiff_t offset) { return transformed<0>(source_.at(offset)); }
+
+    private:
+    template<template<bool> typename, bool, typename, bool>
+    friend struct adapter_state;
+
+    // First passing element from the current source position on
+    inline void seek() {
+        while (!source_.is_equal(this->last_)) {
+            if (pass<0>(source_.get())) {
+                return;
+            }
+            source_.next();
+        }
+    }
+
+    // Runs `value` through the stages from `index` on, caches the result if all filters pass
+    template<std::size_t index, typename TValue>
+    inline bool pass(TValue && value) {
+        if constexpr (index == stage_count) {
+            this->cache_.set(std::forward<TValue>(value));
+            return true;
+        } else {
+            const auto & stage = std::get<index>(container_->stages());
+            if constexpr (detail::is_filter_stage<std::remove_cv_t<std::remove_reference_t<decltype(stage)>>>::value) {
+                if (!stage.predicate_(static_cast<const std::remove_reference_t<TValue> &>(value))) {
+                    return false;
+                }
+                return pass<index + 1>(std::forward<TValue>(value));
+            } else {
+                return pass<index + 1>(stage.function_(std::forward<TValue>(value)));
+            }
+        }
+    }
+
+    // Runs `value` through the transforms from `index` on (transform only pipelines)
+    template<std::size_t index, typename TValue>
+    inline reference transformed(TValue && value) {
+        if constexpr (index == stage_count) {
+            return std::forward<TValue>(value);
+        } else {
+            return transformed<index + 1>(std::get<index>(container_->stages()).function_(std::forward<TValue>(value)));
+        }
+    }
+};
+
+// Lazy view over the source container with the stages `TStages` (a `std::tuple` of `filter_stage` / `transform_stage`)
+// `is_const_source` - the source is a const container, the iterators yield const elements
+template<template<bool> typename TIteratorState, bool is_const_source, typename TStages>
+class adapter_range {
+    template<bool is_const>
+    using iterator_state = adapter_state<TIteratorState, is_const_source, TStages, is_const>;
+
+    public:
+    typedef typename TIteratorState<is_const_source>::container_type source_type;
+    typedef TStages stages_type;
+
+    inline adapter_range(source_type * source, TStages stages): source_(source), stages_(std::move(stages)) {}
+
+    inline source_type * source() const { return source_; }
+    inline const TStages & stages() const { return stages_; }
+
+    SETUP_RANGE_ITERATORS(iterator_state);
+
+    private:
+    source_type * source_;
+    TStages stages_;
+};
+
+// Single stage states over `TIteratorState`, stacked stages fuse into one `adapter_state`
+template<template<bool> typename TIteratorState, typename TPredicate, bool is_const>
+using filter_state = adapter_state<TIteratorState, is_const, std::tuple<filter_stage<TPredicate>>, is_const>;
+
+template<template<bool> typename TIteratorState, typename TFunction, bool is_const>
+using transform_state = adapter_state<TIteratorState, is_const, std::tuple<transform_stage<TFunction>>, is_const>;
+
+// Filter / transform view of a custom container (iterators built with `custom_iterator_template`)
+template<typename TContainer, typename TPredicate, typename std::enable_if<!detail::is_adapter_range<std::remove_const_t<TContainer>>::value, int>::type = 0>
+inline auto make_filter_range(TContainer & container, TPredicate predicate) {
+    typedef typename detail::adapter_range_of<decltype(container.begin()), std::tuple<filter_stage<TPredicate>>>::type range_type;
+    return range_type(&container, std::tuple<filter_stage<TPredicate>>{{std::move(predicate)}});
+}
+
+template<typename TContainer, typename TFunction, typename std::enable_if<!detail::is_adapter_range<std::remove_const_t<TContainer>>::value, int>::type = 0>
+inline auto make_transform_range(TContainer & container, TFunction function) {
+    typedef typename detail::adapter_range_of<decltype(container.begin()), std::tuple<transform_stage<TFunction>>>::type range_type;
+    return range_type(&container, std::tuple<transform_stage<TFunction>>{{std::move(function)}});
+}
+
+// Stacked adapters - the stage is appended to the stages of `range`, the source stays the same
+template<template<bool> typename TIteratorState, bool is_const_source, typename... TStages, typename TPredicate>
+inline adapter_range<TIteratorState, is_const_source, std::tuple<TStages..., filter_stage<TPredicate>>> make_filter_range(const adapter_range<TIteratorState, is_const_source, std::tuple<TStages...>> & range, TPredicate predicate) {
+    return {range.source(), std::tuple_cat(range.stages(), std::tuple<filter_stage<TPredicate>>{{std::move(predicate)}})};
+}
+
+template<template<bool> typename TIteratorState, bool is_const_source, typename... TStages, typename TFunction>
+inline adapter_range<TIteratorState, is_const_source, std::tuple<TStages..., transform_stage<TFunction>>> make_transform_range(const adapter_range<TIteratorState, is_const_source, std::tuple<TStages...>> & range, TFunction function) {
+    return {range.source(), std::tuple_cat(range.stages(), std::tuple<transform_stage<TFunction>>{{std::move(function)}})};
+}
+
+} // namespace foundation
+}  // namespace tmc
+
+#endif
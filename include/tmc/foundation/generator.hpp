@@ -0,0 +1,255 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_generator_hpp_
+#define _tmc_foundation_generator_hpp_
+
+// Coroutine generators (C++20) - lazy producers consumed through `custom_iterator_template` input iterators
+// The coroutine frames come from a thread local frame pool: a producer costs no heap allocation in steady state.
+//
+//   tmc::foundation::generator<int> count(int last) {
+//       for (int value = 0; value < last; ++value) { co_yield value; }
+//   }
+//   for (int value: count(10)) { ... }
+
+#if __cplusplus >= 202002L
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "custom-iterator-template.hpp"
+#include "custom-iterator-template-helper.hpp"
+
+namespace tmc {
+namespace foundation {
+
+namespace detail {
+
+    // Thread local pool of coroutine frames, free lists per size class of 64 bytes up to 1 KiB
+    // A frame is returned to the pool of the thread destroying it, larger frames use the heap directly.
+    // Frames allocated or destroyed after the pool of the thread (e.g. by other `thread_local` objects) use the heap.
+    class frame_pool {
+        public:
+        static constexpr std::size_t granularity = 64;
+        static constexpr std::size_t class_count = 16;
+        static constexpr std::size_t max_frames_per_class = 64;
+
+        static void * allocate(std::size_t size) {
+            // Pooled sizes are rounded to their class: the frame may be returned to the pool of a thread still alive
+            const std::size_t sizeClass = size_class(size);
+            if (sizeClass < class_count) {
+                size = (sizeClass + 1) * granularity;
+            }
+            if (destroyed()) {
+                return ::operator new(size);
+            }
+            if (sizeClass < class_count) {
+                frame_pool &pool = local();
+                if (free_frame *frame = pool.free_[sizeClass]) {
+                    pool.free_[sizeClass] = frame->next_;
+                    --pool.freeCount_[sizeClass];
+                    return frame;
+                }
+            }
+            ++local().heapAllocations_;
+            return ::operator new(size);
+        }
+
+        static void deallocate(void *frame, std::size_t size) noexcept {
+            const std::size_t sizeClass = size_class(size);
+            if (sizeClass < class_count && ! destroyed()) {
+                frame_pool &pool = local();
+                if (pool.freeCount_[sizeClass] < max_frames_per_class) {
+                    pool.free_[sizeClass] = new (frame) free_frame{pool.free_[sizeClass]};
+                    ++pool.freeCount_[sizeClass];
+                    return;
+                }
+            }
+            ::operator delete(frame);
+        }
+
+        // Frames allocated on the heap by the calling thread (pool misses)
+        static std::size_t heap_allocations() { return destroyed() ? 0 : local().heapAllocations_; }
+
+        frame_pool(const frame_pool &) = delete;
+        frame_pool & operator=(const frame_pool &) = delete;
+
+        ~frame_pool() {
+            destroyed() = true;
+            for (free_frame *&list: free_) {
+                while (free_frame *frame = list) {
+                    list = frame->next_;
+                    ::operator delete(frame);
+                }
+            }
+        }
+
+        private:
+        struct free_frame {
+            free_frame *next_;
+        };
+
+        frame_pool() = default;
+
+        static std::size_t size_class(std::size_t size) { return (size + granularity - 1) / granularity - 1; }
+
+        static frame_pool & local() {
+            static thread_local frame_pool pool;
+            return pool;
+        }
+
+        // Trivially destructible, still valid when the pool of the thread is gone
+        static bool & destroyed() {
+            static thread_local bool isDestroyed = false;
+            return isDestroyed;
+        }
+
+        free_frame *free_[class_count]{};
+        std::size_t freeCount_[class_count]{};
+        std::size_t heapAllocations_{0};
+    };
+
+} // namespace detail
+
+template<typename T>
+class generator;
+
+// Iterator state of `generator<T>` - a pointer to the generator, which owns the coroutine
+// Unconnected states are at the end: `end()` needs no generator access
+template<typename T, bool is_const>
+struct generator_state {
+    typedef std::input_iterator_tag iterator_category;
+    typedef generator<T> container_type;
+    typedef const T value_type;
+
+    // Iterators are equal if both are at the end or both are not (single pass)
+    static constexpr bool compares_unconnected = true;
+
+    // All copies see the current value of the coroutine
+    static constexpr bool copies_share_position = true;
+
+    container_type * container_{nullptr};
+
+    // Default Construction without container connection (ALL Iterators)
+    inline generator_state() = default;
+
+    // Construction with connected container (ALL Iterators)
+    inline generator_state(container_type * container): container_(container) {}
+
+    // Copy Construction - defaulted, copies share the coroutine (ALL Iterators)
+    inline generator_state(const generator_state & source) = default;
+
+    // Start and End Positions - `begin()` runs the coroutine to its first `co_yield` (ALL Iterators)
+    inline void begin() { container_->start(); }
+    inline void end() { container_ = nullptr; }
+
+    // Availability and Equality (ALL Iterators)
+    inline bool is_connected() const { return container_ != nullptr; }
+
+    template<bool other_is_const>
+    inline bool is_equal(const generator_state<T, other_is_const> & other) const { return at_end() == other.at_end(); }
+
+    inline bool at_end() const { return container_ == nullptr || container_->done(); }
+
+    // Move Next - runs the coroutine to its next `co_yield` (ALL Iterators)
+    inline void next() { container_->resume(); }
+
+    // Element Access - the yielded value, valid until the next increment (ALL Iterators)
+    inline value_type & get() const { return container_->value(); }
+};
+
+// Lazy sequence of the values yielded by a coroutine, single pass and move only
+// Exceptions of the coroutine are rethrown by the increment (or `begin()`) that resumed it.
+template<typename T>
+class generator {
+    template<bool is_const>
+    using iterator_state = generator_state<T, is_const>;
+
+    template<typename, bool>
+    friend struct generator_state;
+
+    public:
+    typedef T value_type;
+
+    struct promise_type {
+        const T *value_{nullptr};
+        std::exception_ptr exception_;
+
+        generator get_return_object() { return generator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        // The yielded object lives in the coroutine frame until the coroutine is resumed
+        std::suspend_always yield_value(const T &value) noexcept {
+            value_ = std::addressof(value);
+            return {};
+        }
+
+        void return_void() noexcept {}
+        void unhandled_exception() { exception_ = std::current_exception(); }
+
+        // Coroutine frames from the thread local frame pool
+        static void * operator new(std::size_t size) { return detail::frame_pool::allocate(size); }
+        static void operator delete(void *frame, std::size_t size) noexcept { detail::frame_pool::deallocate(frame, size); }
+    };
+
+    inline generator(generator &&source) noexcept: coroutine_(std::exchange(source.coroutine_, nullptr)), started_(source.started_) {}
+
+    inline generator & operator=(generator &&source) noexcept {
+        if (this != &source) {
+            destroy();
+            coroutine_ = std::exchange(source.coroutine_, nullptr);
+            started_ = source.started_;
+        }
+        return *this;
+    }
+
+    generator(const generator &) = delete;
+    generator & operator=(const generator &) = delete;
+
+    inline ~generator() { destroy(); }
+
+    // Single pass: no const iteration
+    SETUP_MUTABLE_ITERATOR(iterator_state);
+
+    private:
+    inline explicit generator(std::coroutine_handle<promise_type> coroutine): coroutine_(coroutine) {}
+
+    inline void start() {
+        if (!started_) {
+            started_ = true;
+            resume();
+        }
+    }
+
+    inline void resume() {
+        coroutine_.resume();
+        if (coroutine_.promise().exception_) {
+            std::rethrow_exception(std::exchange(coroutine_.promise().exception_, nullptr));
+        }
+    }
+
+    inline bool done() const { return !coroutine_ || coroutine_.done(); }
+    inline const T & value() const { return *coroutine_.promise().value_; }
+
+    inline void destroy() {
+        if (coroutine_) {
+            coroutine_.destroy();
+        }
+    }
+
+    std::coroutine_handle<promise_type> coroutine_;
+    bool started_{false};
+};
+
+} // namespace foundation
+}  // namespace tmc
+
+#endif
+
+#endif
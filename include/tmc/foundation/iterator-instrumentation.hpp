@@ -0,0 +1,237 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_iterator_instrumentation_hpp_
+#define _tmc_foundation_iterator_instrumentation_hpp_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+#include "custom-iterator-template.hpp"
+
+// Iterator instrumentation - counts the operations of `custom_iterator_template` instantiations per iterator type:
+// `next`, `prev`, `move`, `get` (also `operator->` and `operator[]`), `is_equal` and copies (also moves and
+// changeable -> const conversions). The counters are sharded: every thread owns a cache line padded shard and counts
+// with plain (non read-modify-write) relaxed stores, the shards are aggregated on demand by
+// `counting_instrumentation::counts<TIterator>()` and `report()`. A shard is released when its thread ends, the counts
+// stay in the shard.
+//
+//   typedef tmc::foundation::custom_iterator_template<iterator_state, false, tmc::foundation::default_iterator_policy,
+//                                                     tmc::foundation::counting_instrumentation> iterator;
+//
+// The default policy `no_instrumentation` adds neither code nor storage.
+
+namespace tmc {
+namespace foundation {
+
+// Counter shards per iterator type owned by one thread each, threads beyond this count share an overflow shard
+inline constexpr std::size_t iterator_counter_shards = 16;
+
+// Cache line size the shards are padded to
+inline constexpr std::size_t iterator_counter_line_size = 64;
+
+// Aggregated operation counts of an iterator type
+struct iterator_operation_counts {
+    std::uint64_t counts_[iterator_operation_count]{};
+
+    inline std::uint64_t operator[](iterator_operation operation) const { return counts_[static_cast<std::size_t>(operation)]; }
+
+    inline std::uint64_t total() const {
+        std::uint64_t sum = 0;
+        for (std::uint64_t count: counts_) {
+            sum += count;
+        }
+        return sum;
+    }
+};
+
+// Operation counts of one iterator type in `counting_instrumentation::report()`
+struct iterator_operation_report {
+    std::string iterator_name;
+    iterator_operation_counts counts;
+};
+
+namespace detail {
+
+    // Shard ownership of a thread: a free shard is claimed on the first count of the thread and released when it ends,
+    // the overflow shard `iterator_counter_shards` is shared by all threads without an own shard
+    class iterator_counter_shard_owner {
+        public:
+        iterator_counter_shard_owner() {
+            std::uint32_t used = usedShards().load(std::memory_order_relaxed);
+            while (used != all_shards) {
+                std::size_t free = 0;
+                while (used & (1u << free)) {
+                    ++free;
+                }
+                if (usedShards().compare_exchange_weak(used, used | (1u << free), std::memory_order_acquire, std::memory_order_relaxed)) {
+                    index_ = free;
+                    return;
+                }
+            }
+        }
+
+        ~iterator_counter_shard_owner() {
+            if (is_exclusive()) {
+                usedShards().fetch_and(~(1u << index_), std::memory_order_release);
+            }
+        }
+
+        iterator_counter_shard_owner(const iterator_counter_shard_owner &) = delete;
+        iterator_counter_shard_owner & operator=(const iterator_counter_shard_owner &) = delete;
+
+        inline std::size_t index() const { return index_; }
+        inline bool is_exclusive() const { return index_ != iterator_counter_shards; }
+
+        private:
+        static_assert(iterator_counter_shards < 32, "Shard ownership is a 32 bit mask");
+        static constexpr std::uint32_t all_shards = (1u << iterator_counter_shards) - 1;
+
+        static std::atomic<std::uint32_t> & usedShards() {
+            static std::atomic<std::uint32_t> used{0};
+            return used;
+        }
+
+        std::size_t index_{iterator_counter_shards};
+    };
+
+    inline const iterator_counter_shard_owner & iterator_counter_shard() {
+        thread_local const iterator_counter_shard_owner owner;
+        return owner;
+    }
+
+    inline std::string demangled_name(const char * name) {
+#if defined(__GNUG__)
+        int status = 0;
+        std::unique_ptr<char, void (*)(void *)> demangled(abi::__cxa_demangle(name, nullptr, nullptr, &status), std::free);
+        if (status == 0 && demangled) {
+            return demangled.get();
+        }
+#endif
+        return name;
+    }
+
+    // Counters of one iterator type: one cache line per shard, the owning thread is the only writer of its shard
+    class iterator_counters {
+        public:
+        explicit iterator_counters(std::string iteratorName): iteratorName_(std::move(iteratorName)) {}
+
+        iterator_counters(const iterator_counters &) = delete;
+        iterator_counters & operator=(const iterator_counters &) = delete;
+
+        inline void add(iterator_operation operation) {
+            const iterator_counter_shard_owner & owner = iterator_counter_shard();
+            std::atomic<std::uint64_t> & count = shards_[owner.index()].counts_[static_cast<std::size_t>(operation)];
+            if (owner.is_exclusive()) {
+                count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            } else {
+                count.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        iterator_operation_counts aggregate() const {
+            iterator_operation_counts result;
+            for (const shard &current: shards_) {
+                for (std::size_t operation = 0; operation < iterator_operation_count; ++operation) {
+                    result.counts_[operation] += current.counts_[operation].load(std::memory_order_relaxed);
+                }
+            }
+            return result;
+        }
+
+        void reset() {
+            for (shard &current: shards_) {
+                for (auto &count: current.counts_) {
+                    count.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        const std::string & iterator_name() const { return iteratorName_; }
+
+        private:
+        struct alignas(iterator_counter_line_size) shard {
+            std::atomic<std::uint64_t> counts_[iterator_operation_count]{};
+        };
+
+        shard shards_[iterator_counter_shards + 1];
+        std::string iteratorName_;
+    };
+
+    // All iterator types counted so far
+    class iterator_counters_registry {
+        public:
+        static iterator_counters_registry & instance() {
+            static iterator_counters_registry registry;
+            return registry;
+        }
+
+        void add(const iterator_counters * counters) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            counters_.push_back(counters);
+        }
+
+        template<typename TFunction>
+        void for_each(TFunction function) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const iterator_counters * counters: counters_) {
+                function(*counters);
+            }
+        }
+
+        private:
+        std::mutex mutex_;
+        std::vector<const iterator_counters *> counters_;
+    };
+
+    template<typename TIterator>
+    inline iterator_counters & counters_of() {
+        static iterator_counters & counters = []() -> iterator_counters & {
+            static iterator_counters instance(demangled_name(typeid(TIterator).name()));
+            iterator_counters_registry::instance().add(&instance);
+            return instance;
+        }();
+        return counters;
+    }
+
+} // namespace detail
+
+// Instrumentation policy counting the iterator operations per iterator type
+struct counting_instrumentation {
+    static constexpr bool enabled = true;
+
+    template<typename TIterator>
+    static inline void count(iterator_operation operation) { detail::counters_of<TIterator>().add(operation); }
+
+    // Counts of `TIterator` summed over all threads
+    template<typename TIterator>
+    static iterator_operation_counts counts() { return detail::counters_of<TIterator>().aggregate(); }
+
+    // Counts of all iterator types used so far, summed over all threads
+    static std::vector<iterator_operation_report> report() {
+        std::vector<iterator_operation_report> result;
+        detail::iterator_counters_registry::instance().for_each([&result](const detail::iterator_counters & counters) {
+            result.push_back(iterator_operation_report{counters.iterator_name(), counters.aggregate()});
+        });
+        return result;
+    }
+
+    // Restarts counting of `TIterator` - counts of concurrent operations may get lost
+    template<typename TIterator>
+    static void reset() { detail::counters_of<TIterator>().reset(); }
+};
+
+} // namespace foundation
+}  // namespace tmc
+
+#endif
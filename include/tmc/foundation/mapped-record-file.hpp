@@ -0,0 +1,263 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_mapped_record_file_hpp_
+#define _tmc_foundation_mapped_record_file_hpp_
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "custom-iterator-template.hpp"
+#include "custom-iterator-template-helper.hpp"
+
+// Memory mapped files of fixed size records (POSIX) - the records are read in place, nothing is copied
+// The file is mapped read only, the pages are loaded on first access: opening a multi-gigabyte file costs a few
+// system calls instead of a read of the whole file. Bytes behind the last complete record are ignored.
+//
+//   tmc::foundation::mapped_record_file<Record> records("records.bin", tmc::foundation::access_hint::sequential);
+//   for (const Record &record: records) { ... }
+
+namespace tmc {
+namespace foundation {
+
+// Expected access pattern of a mapping, passed to `madvise()`
+enum class access_hint {
+    normal,         // default read ahead
+    sequential,     // aggressive read ahead, pages behind the scan can be dropped early
+    random,         // no read ahead
+    will_need       // start reading the whole file in the background
+};
+
+// Alignment of huge page aligned mappings (2 MiB huge pages of x86-64 / AArch64 with 4K pages)
+inline constexpr std::size_t huge_page_size = std::size_t{2} * 1024 * 1024;
+
+template<typename TRecord>
+class mapped_record_file;
+
+namespace detail {
+
+    inline int advice(access_hint hint) {
+        switch (hint) {
+            case access_hint::sequential: return MADV_SEQUENTIAL;
+            case access_hint::random: return MADV_RANDOM;
+            case access_hint::will_need: return MADV_WILLNEED;
+            default: return MADV_NORMAL;
+        }
+    }
+
+    // Maps `length` bytes of `fd` read only at a huge page aligned address: reserves a larger anonymous range,
+    // maps the file over its aligned part and releases the slack. Transparent huge pages are requested where available.
+    inline void * map_huge_page_aligned(int fd, std::size_t length) {
+        const std::size_t reserved = length + huge_page_size;
+        void *reservation = ::mmap(nullptr, reserved, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reservation == MAP_FAILED) {
+            return MAP_FAILED;
+        }
+
+        const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(reservation);
+        const std::uintptr_t aligned = (first + huge_page_size - 1) & ~std::uintptr_t{huge_page_size - 1};
+        void *mapping = ::mmap(reinterpret_cast<void *>(aligned), length, PROT_READ, MAP_SHARED | MAP_FIXED, fd, 0);
+        if (mapping == MAP_FAILED) {
+            // The caller reports the `errno` of the failed mapping
+            const int error = errno;
+            ::munmap(reservation, reserved);
+            errno = error;
+            return MAP_FAILED;
+        }
+
+        const std::size_t pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const std::uintptr_t mappedEnd = aligned + ((length + pageSize - 1) & ~(pageSize - 1));
+        if (aligned > first) {
+            ::munmap(reservation, aligned - first);
+        }
+        if (first + reserved > mappedEnd) {
+            ::munmap(reinterpret_cast<void *>(mappedEnd), first + reserved - mappedEnd);
+        }
+#ifdef MADV_HUGEPAGE
+        ::madvise(mapping, length, MADV_HUGEPAGE);
+#endif
+        return mapping;
+    }
+
+} // namespace detail
+
+// Iterator state of `mapped_record_file<TRecord>` - a record pointer into the mapping
+// The records are read only: both variants access `const TRecord`. Contiguous iterator in C++20.
+template<typename TRecord, bool is_const>
+struct mapped_record_state {
+#if __cplusplus >= 202002L
+    typedef std::contiguous_iterator_tag iterator_category;
+#else
+    typedef std::random_access_iterator_tag iterator_category;
+#endif
+    typedef typename std::conditional<is_const, const mapped_record_file<TRecord>, mapped_record_file<TRecord>>::type container_type;
+    typedef const TRecord value_type;
+
+    // Unconnected states have a null position, equal to the positions of empty (unmapped) files only
+    static constexpr bool compares_unconnected = true;
+
+    // A position in the mapped record array: unchecked iterators are record pointers
+    static constexpr bool collapses_to_pointer = true;
+
+    container_type * container_{nullptr};
+    value_type * current_{nullptr};
+
+    // Default Construction without container connection (ALL Iterators)
+    inline mapped_record_state() = default;
+
+    // Construction with connected container (ALL Iterators)
+    inline mapped_record_state(container_type * container): container_(container) {}
+
+    // Copy Construction - defaulted to keep the state trivially copyable (ALL Iterators)
+    inline mapped_record_state(const mapped_record_state & source) = default;
+
+    // Copy Construction from the changeable variant (ALL Iterators)
+    template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+    inline mapped_record_state(const mapped_record_state<TRecord, other_is_const> & source): container_(source.container_), current_(source.current_) {}
+
+    // Start and End Positions (ALL Iterators)
+    inline void begin() { current_ = container_->data(); }
+    inline void end() { current_ = container_->data() + container_->size(); }
+
+    // Availability and Equality (ALL Iterators)
+    inline bool is_connected() const { return container_ != nullptr; }
+
+    template<bool other_is_const>
+    inline bool is_equal(const mapped_record_state<TRecord, other_is_const> & other) const { return current_ == other.current_; }
+
+    // Move Next (ALL Iterators)
+    inline void next() { ++current_; }
+
+    // Element Access (ALL Iterators)
+    inline value_type & get() const { return *current_; }
+
+    // Raw address of the current record (Contiguous Iterators)
+    inline value_type * address() const { return current_; }
+
+    // Move Previous (Bidirectional, Random Access Iterators)
+    inline void prev() { --current_; }
+
+    // Move to position (Random Access Iterators)
+    inline void move(std::ptrdiff_t offset) { current_ += offset; }
+
+    // Calculate Distance (Random Access Iterators)
+    template<bool other_is_const>
+    inline std::ptrdiff_t distance(const mapped_record_state<TRecord, other_is_const> & rhs) const { return current_ - rhs.current_; }
+
+    // Element access at position (Random Access Iterators)
+    inline value_type & at(std::ptrdiff_t offset) const { return current_[offset]; }
+};
+
+// Read only memory mapping of a file of `TRecord` records, movable but not copyable
+// Failing system calls throw `std::system_error`. The iterators are valid as long as the mapping exists.
+template<typename TRecord>
+class mapped_record_file {
+    static_assert(std::is_trivially_copyable<TRecord>::value, "Records must be trivially copyable to be read in place");
+
+    template<bool is_const>
+    using iterator_state = mapped_record_state<TRecord, is_const>;
+
+    public:
+    typedef TRecord value_type;
+    typedef std::size_t size_type;
+
+    inline mapped_record_file() = default;
+
+    // Maps the file at `path` - `hugePageAligned` places the mapping at a `huge_page_size` boundary
+    explicit mapped_record_file(const std::string &path, access_hint hint = access_hint::normal, bool hugePageAligned = false) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "open " + path);
+        }
+
+        struct stat status;
+        if (::fstat(fd, &status) != 0) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "fstat " + path);
+        }
+
+        length_ = static_cast<std::size_t>(status.st_size);
+        count_ = length_ / sizeof(TRecord);
+        if (length_ > 0) {
+            void *mapping = hugePageAligned ? detail::map_huge_page_aligned(fd, length_) : ::mmap(nullptr, length_, PROT_READ, MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED) {
+                const int error = errno;
+                ::close(fd);
+                length_ = count_ = 0;
+                throw std::system_error(error, std::generic_category(), "mmap " + path);
+            }
+            mapping_ = mapping;
+        }
+        // The mapping keeps the file referenced
+        ::close(fd);
+
+        // The destructor of a partly constructed file does not run
+        try {
+            advise(hint);
+        } catch (...) {
+            unmap();
+            throw;
+        }
+    }
+
+    mapped_record_file(const mapped_record_file &) = delete;
+    mapped_record_file & operator=(const mapped_record_file &) = delete;
+
+    inline mapped_record_file(mapped_record_file &&source) noexcept:
+        mapping_(std::exchange(source.mapping_, nullptr)), length_(std::exchange(source.length_, 0)), count_(std::exchange(source.count_, 0)) {}
+
+    inline mapped_record_file & operator=(mapped_record_file &&source) noexcept {
+        if (this != &source) {
+            unmap();
+            mapping_ = std::exchange(source.mapping_, nullptr);
+            length_ = std::exchange(source.length_, 0);
+            count_ = std::exchange(source.count_, 0);
+        }
+        return *this;
+    }
+
+    inline ~mapped_record_file() { unmap(); }
+
+    // Changes the expected access pattern, e.g. `random` for a lookup phase after a `sequential` load phase
+    void advise(access_hint hint) const {
+        if (mapping_ != nullptr && ::madvise(mapping_, length_, detail::advice(hint)) != 0) {
+            throw std::system_error(errno, std::generic_category(), "madvise");
+        }
+    }
+
+    inline const TRecord * data() const { return static_cast<const TRecord *>(mapping_); }
+    inline std::size_t size() const { return count_; }
+    inline bool empty() const { return count_ == 0; }
+    inline std::size_t size_bytes() const { return length_; }
+
+    inline const TRecord & operator[](std::size_t index) const { return data()[index]; }
+
+    SETUP_RANGE_ITERATORS(iterator_state);
+    SETUP_REVERSE_ITERATORS(iterator_state);
+
+    private:
+    inline void unmap() {
+        if (mapping_ != nullptr) {
+            ::munmap(mapping_, length_);
+        }
+    }
+
+    void *mapping_{nullptr};
+    std::size_t length_{0};
+    std::size_t count_{0};
+};
+
+} // namespace foundation
+}  // namespace tmc
+
+#endif
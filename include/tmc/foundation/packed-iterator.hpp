@@ -0,0 +1,237 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_packed_iterator_hpp_
+#define _tmc_foundation_packed_iterator_hpp_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "custom-iterator-template.hpp"
+
+// Packed iterator protocol - optional extension of the iterator state for containers packing unsigned integers of
+// `packed_bits` bits into 64 bit words: element `i` is lane `i % lanes` of word `i / lanes` with `lanes = 64 / packed_bits`,
+// a lane never straddles two words.
+// The state implements:
+// - `static constexpr unsigned packed_bits`   - bits per element, 1 ... 32
+// - `word_type * words() const`               - the packed words, `std::uint64_t` (`const std::uint64_t` for const iterators)
+// - `std::size_t index() const`               - element index of the current position
+//
+// The algorithms of algorithms.hpp (`count`, `fill`, `copy`, `accumulate`) process the full words of such ranges
+// a word at a time instead of extracting one element per iterator step: lanes are compared and filled with SWAR
+// (SIMD within a register) bit tricks and decoded by unrolled shifts, the word loops are left to the vectorizer.
+
+namespace tmc {
+namespace foundation {
+
+template<typename TIterator, typename = void>
+struct packed_iterator_traits {
+    static constexpr bool is_packed = false;
+};
+
+template<template<bool> typename TIteratorState, bool is_const, typename TCheckPolicy, typename TInstrumentation>
+struct packed_iterator_traits<custom_iterator_template<TIteratorState, is_const, TCheckPolicy, TInstrumentation>, std::void_t<decltype(TIteratorState<is_const>::packed_bits)>> {
+    static constexpr bool is_packed = true;
+    static constexpr unsigned bits = TIteratorState<is_const>::packed_bits;
+
+    typedef custom_iterator_template<TIteratorState, is_const, TCheckPolicy, TInstrumentation> iterator;
+    typedef typename std::remove_cv<typename TIteratorState<is_const>::value_type>::type value_type;
+
+    static inline auto words(const iterator &it) { return custom_iterator_access::state(it).words(); }
+    static inline std::size_t index(const iterator &it) { return custom_iterator_access::state(it).index(); }
+};
+
+namespace detail {
+
+    inline std::uint64_t popcount(std::uint64_t word) {
+#if defined(__POPCNT__) && (defined(__GNUC__) || defined(__clang__))
+        return static_cast<std::uint64_t>(__builtin_popcountll(word));
+#else
+        // Without a popcount instruction the builtin is a library call, the SWAR version inlines and vectorizes
+        word = word - ((word >> 1) & 0x5555555555555555ull);
+        word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+        word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0full;
+        return (word * 0x0101010101010101ull) >> 56;
+#endif
+    }
+
+    // Lanes of `bits` wide elements in a 64 bit word
+    template<unsigned bits>
+    struct packed_layout {
+        static_assert(bits >= 1 && bits <= 32, "Packed elements have 1 ... 32 bits");
+
+        static constexpr std::size_t lanes = 64 / bits;
+        static constexpr std::uint64_t mask = (std::uint64_t{1} << bits) - 1;
+
+        // `value` in every lane
+        static constexpr std::uint64_t replicate(std::uint64_t value) {
+            std::uint64_t word = 0;
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                word |= (value & mask) << (lane * bits);
+            }
+            return word;
+        }
+
+        // Bits of the lanes [from, to)
+        static constexpr std::uint64_t lanes_mask(std::size_t from, std::size_t to) {
+            const std::uint64_t belowTo = to * bits >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << (to * bits)) - 1;
+            return belowTo & ~((std::uint64_t{1} << (from * bits)) - 1);
+        }
+
+        static constexpr std::uint64_t lowest_bits = replicate(1);
+        static constexpr std::uint64_t high_bits = replicate(std::uint64_t{1} << (bits - 1));
+        static constexpr std::uint64_t low_bits = replicate(mask >> 1);
+
+        static inline std::uint64_t lane(std::uint64_t word, std::size_t lane) { return (word >> (lane * bits)) & mask; }
+
+        // High bit of every lane of `word` equal to the lane of `pattern`: the low bits of a lane carry into its high bit
+        // if any of them differs, without a carry into the next lane
+        static inline std::uint64_t equal_lanes(std::uint64_t word, std::uint64_t pattern) {
+            const std::uint64_t difference = word ^ pattern;
+            return ~(((difference & low_bits) + low_bits) | difference) & high_bits;
+        }
+
+        // Sum of all lanes: bit planes counted for narrow lanes, unrolled lane decoding for wide lanes
+        static inline std::uint64_t lane_sum(std::uint64_t word) {
+            std::uint64_t sum = 0;
+            if constexpr (bits <= 4) {
+                for (unsigned bit = 0; bit < bits; ++bit) {
+                    sum += popcount(word & (lowest_bits << bit)) << bit;
+                }
+            } else {
+                for (std::size_t lane = 0; lane < lanes; ++lane) {
+                    sum += (word >> (lane * bits)) & mask;
+                }
+            }
+            return sum;
+        }
+    };
+
+    // Calls `process(word, fromLane, toLane)` for each word holding elements of [first, last)
+    // Full words pass the lanes as `std::integral_constant`: the lane loops of their instantiation have constant bounds
+    template<unsigned bits, typename TWord, typename TProcess>
+    inline void for_each_packed_word(TWord *words, std::size_t first, std::size_t last, TProcess process) {
+        typedef packed_layout<bits> layout;
+        if (first >= last) {
+            return;
+        }
+
+        std::size_t word = first / layout::lanes;
+        const std::size_t lastWord = last / layout::lanes;
+        const std::size_t firstLane = first % layout::lanes;
+        const std::size_t lastLane = last % layout::lanes;
+        if (word == lastWord) {
+            process(words[word], firstLane, lastLane);
+            return;
+        }
+
+        if (firstLane != 0) {
+            process(words[word], firstLane, layout::lanes);
+            ++word;
+        }
+
+        for (; word != lastWord; ++word) {
+            process(words[word], std::integral_constant<std::size_t, 0>(), std::integral_constant<std::size_t, layout::lanes>());
+        }
+
+        if (lastLane != 0) {
+            process(words[lastWord], std::size_t{0}, lastLane);
+        }
+    }
+
+    template<unsigned bits>
+    inline std::size_t packed_count(const std::uint64_t *words, std::size_t first, std::size_t last, std::uint64_t value) {
+        typedef packed_layout<bits> layout;
+        if (value > layout::mask) {
+            return 0;
+        }
+
+        const std::uint64_t pattern = layout::replicate(value);
+        std::uint64_t count = 0;
+        for_each_packed_word<bits>(words, first, last, [&count, pattern](std::uint64_t word, auto from, auto to) {
+            count += popcount(layout::equal_lanes(word, pattern) & layout::lanes_mask(from, to));
+        });
+        return static_cast<std::size_t>(count);
+    }
+
+    template<unsigned bits>
+    inline void packed_fill(std::uint64_t *words, std::size_t first, std::size_t last, std::uint64_t value) {
+        typedef packed_layout<bits> layout;
+        const std::uint64_t pattern = layout::replicate(value);
+        for_each_packed_word<bits>(words, first, last, [pattern](std::uint64_t &word, auto from, auto to) {
+            const std::uint64_t lanes = layout::lanes_mask(from, to);
+            word = (word & ~lanes) | (pattern & lanes);
+        });
+    }
+
+    template<unsigned bits>
+    inline std::uint64_t packed_sum(const std::uint64_t *words, std::size_t first, std::size_t last) {
+        typedef packed_layout<bits> layout;
+        std::uint64_t sum = 0;
+        for_each_packed_word<bits>(words, first, last, [&sum](std::uint64_t word, auto from, auto to) {
+            sum += layout::lane_sum(word & layout::lanes_mask(from, to));
+        });
+        return sum;
+    }
+
+    // Calls `process(value)` for the elements [first, last) in order, decoding a word at a time
+    template<unsigned bits, typename TProcess>
+    inline void packed_decode(const std::uint64_t *words, std::size_t first, std::size_t last, TProcess process) {
+        typedef packed_layout<bits> layout;
+        for_each_packed_word<bits>(words, first, last, [&process](std::uint64_t word, auto from, auto to) {
+            for (std::size_t lane = from; lane < to; ++lane) {
+                process(layout::lane(word, lane));
+            }
+        });
+    }
+
+    // Stores the elements [first, last) at `result`, returns the end of the stored values
+    template<unsigned bits, typename T>
+    inline T * packed_unpack(const std::uint64_t *words, std::size_t first, std::size_t last, T *result) {
+        typedef packed_layout<bits> layout;
+        for_each_packed_word<bits>(words, first, last, [&result](std::uint64_t word, auto from, auto to) {
+            for (std::size_t lane = from; lane < to; ++lane) {
+                result[lane - from] = static_cast<T>(layout::lane(word, lane));
+            }
+            result += to - from;
+        });
+        return result;
+    }
+
+    // Stores the values of `source` into the elements [first, last) in order, encoding a word at a time
+    template<unsigned bits, typename TInputIterator>
+    inline TInputIterator packed_encode(std::uint64_t *words, std::size_t first, std::size_t last, TInputIterator source) {
+        typedef packed_layout<bits> layout;
+        for_each_packed_word<bits>(words, first, last, [&source](std::uint64_t &word, auto from, auto to) {
+            std::uint64_t encoded = 0;
+            for (std::size_t lane = from; lane < to; ++lane, ++source) {
+                encoded |= (static_cast<std::uint64_t>(*source) & layout::mask) << (lane * bits);
+            }
+            const std::uint64_t lanes = layout::lanes_mask(from, to);
+            word = (word & ~lanes) | encoded;
+        });
+        return source;
+    }
+
+    // Copies the elements [first, last) to the elements starting at `target` of `targetWords`, both at the same lane
+    template<unsigned bits>
+    inline void packed_copy_aligned(const std::uint64_t *words, std::size_t first, std::size_t last, std::uint64_t *targetWords, std::size_t target) {
+        typedef packed_layout<bits> layout;
+        std::uint64_t *targetFirst = targetWords + target / layout::lanes;
+        const std::uint64_t *sourceFirst = words + first / layout::lanes;
+        for_each_packed_word<bits>(words, first, last, [targetFirst, sourceFirst](const std::uint64_t &word, auto from, auto to) {
+            std::uint64_t &targetWord = targetFirst[&word - sourceFirst];
+            const std::uint64_t lanes = layout::lanes_mask(from, to);
+            targetWord = (targetWord & ~lanes) | (word & lanes);
+        });
+    }
+
+} // namespace detail
+
+} // namespace foundation
+}  // namespace tmc
+
+#endif
@@ -0,0 +1,351 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_parallel_hpp_
+#define _tmc_foundation_parallel_hpp_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Parallel algorithms for random access iterators (custom iterators included) on a work stealing thread pool
+// The ranges are split through `operator+` / `operator-`, which map to the `move()` / `distance()` hooks of the state.
+// The algorithms do not need the standard execution policies and do not copy the elements.
+
+namespace tmc {
+namespace foundation {
+
+namespace detail {
+
+    // Fork/join task living on the stack of the forking thread until it is done
+    struct pool_task {
+        void (*execute)(pool_task *task);
+        std::atomic<bool> done{false};
+        std::exception_ptr exception;
+    };
+
+    template<typename TFunction>
+    struct function_pool_task: pool_task {
+        TFunction &function_;
+
+        explicit function_pool_task(TFunction &function): function_(function) { execute = &run; }
+
+        static void run(pool_task *task) {
+            auto *self = static_cast<function_pool_task *>(task);
+            try {
+                self->function_();
+            } catch (...) {
+                self->exception = std::current_exception();
+            }
+            self->done.store(true, std::memory_order_release);
+        }
+    };
+
+    // Task queue of one thread: the owner pushes and pops at the back, other threads steal from the front
+    struct alignas(64) pool_queue {
+        std::mutex mutex;
+        std::deque<pool_task *> tasks;
+    };
+
+} // namespace detail
+
+// Work stealing thread pool for fork/join parallelism
+// `thread_count()` threads take part in the work: the worker threads plus the thread calling `invoke()`.
+// Each worker owns a task queue, idle threads steal the oldest (largest) tasks of the other queues.
+class thread_pool {
+    public:
+    explicit thread_pool(std::size_t threadCount = std::thread::hardware_concurrency()):
+        threadCount_(threadCount > 0 ? threadCount : 1),
+        queues_(new detail::pool_queue[threadCount_]) {
+        workers_.reserve(threadCount_ - 1);
+        for (std::size_t index = 1; index < threadCount_; ++index) {
+            workers_.emplace_back([this, index] { work(index); });
+        }
+    }
+
+    thread_pool(const thread_pool &) = delete;
+    thread_pool & operator=(const thread_pool &) = delete;
+
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+            stop_ = true;
+        }
+        wakeup_.notify_all();
+        for (auto &worker: workers_) {
+            worker.join();
+        }
+    }
+
+    std::size_t thread_count() const { return threadCount_; }
+
+    // Runs `left` and `right` in parallel: `right` becomes a stealable task, `left` runs on the calling thread,
+    // which helps with other tasks until `right` is done. Exceptions are rethrown on the calling thread.
+    template<typename TLeft, typename TRight>
+    void invoke(TLeft &&left, TRight &&right) {
+        detail::function_pool_task<std::remove_reference_t<TRight>> task(right);
+        const std::size_t index = current_queue();
+        push(index, &task);
+
+        try {
+            left();
+        } catch (...) {
+            join(index, task);
+            throw;
+        }
+
+        join(index, task);
+        if (task.exception) {
+            std::rethrow_exception(task.exception);
+        }
+    }
+
+    // Pool used by the algorithms without pool argument
+    static thread_pool & default_pool() {
+        static thread_pool pool;
+        return pool;
+    }
+
+    private:
+    // Queue of the calling thread: the own queue for workers, the shared queue 0 for all other threads
+    std::size_t current_queue() const {
+        return current_pool() == this ? current_index() : 0;
+    }
+
+    static const thread_pool * & current_pool() {
+        static thread_local const thread_pool *pool = nullptr;
+        return pool;
+    }
+
+    static std::size_t & current_index() {
+        static thread_local std::size_t index = 0;
+        return index;
+    }
+
+    void push(std::size_t index, detail::pool_task *task) {
+        {
+            std::lock_guard<std::mutex> lock(queues_[index].mutex);
+            queues_[index].tasks.push_back(task);
+        }
+
+        pendingCount_.fetch_add(1, std::memory_order_release);
+        if (threadCount_ > 1) {
+            { std::lock_guard<std::mutex> lock(sleepMutex_); }
+            wakeup_.notify_one();
+        }
+    }
+
+    // Newest task of the own queue, oldest task of the other queues
+    detail::pool_task * take(std::size_t index) {
+        {
+            std::lock_guard<std::mutex> lock(queues_[index].mutex);
+            if (!queues_[index].tasks.empty()) {
+                detail::pool_task *task = queues_[index].tasks.back();
+                queues_[index].tasks.pop_back();
+                return task;
+            }
+        }
+
+        for (std::size_t offset = 1; offset < threadCount_; ++offset) {
+            detail::pool_queue &victim = queues_[(index + offset) % threadCount_];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                detail::pool_task *task = victim.tasks.front();
+                victim.tasks.pop_front();
+                return task;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool run_one(std::size_t index) {
+        detail::pool_task *task = take(index);
+        if (task == nullptr) {
+            return false;
+        }
+
+        pendingCount_.fetch_sub(1, std::memory_order_relaxed);
+        task->execute(task);
+        return true;
+    }
+
+    // Helps with other tasks until `task` is done - the task is most likely still on top of the own queue
+    void join(std::size_t index, const detail::pool_task &task) {
+        while (!task.done.load(std::memory_order_acquire)) {
+            if (!run_one(index)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void work(std::size_t index) {
+        current_pool() = this;
+        current_index() = index;
+
+        for (;;) {
+            if (run_one(index)) {
+                continue;
+            }
+
+            // Bounded sleep: idle workers look for work at least every 10ms
+            std::unique_lock<std::mutex> lock(sleepMutex_);
+            wakeup_.wait_for(lock, std::chrono::milliseconds(10), [this] { return stop_ || pendingCount_.load(std::memory_order_acquire) > 0; });
+            if (stop_) {
+                return;
+            }
+        }
+    }
+
+    const std::size_t threadCount_;
+    std::unique_ptr<detail::pool_queue[]> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<std::ptrdiff_t> pendingCount_{0};
+    std::mutex sleepMutex_;
+    std::condition_variable wakeup_;
+    bool stop_{false};
+};
+
+namespace detail {
+
+    template<typename TIterator>
+    inline constexpr bool is_random_access_iterator = std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<TIterator>::iterator_category>::value;
+
+    // Elements per task: about 8 tasks per thread for load balancing, the whole range for a single thread
+    inline std::ptrdiff_t grain_size(const thread_pool &pool, std::ptrdiff_t count, std::ptrdiff_t grain) {
+        if (grain > 0) {
+            return grain;
+        }
+
+        const std::ptrdiff_t threadCount = static_cast<std::ptrdiff_t>(pool.thread_count());
+        return threadCount == 1 ? std::max<std::ptrdiff_t>(count, 1) : std::max<std::ptrdiff_t>(count / (threadCount * 8), 1);
+    }
+
+    template<typename TIterator, typename TFunction>
+    void parallel_for_each(thread_pool &pool, TIterator first, std::ptrdiff_t count, TFunction &function, std::ptrdiff_t grain) {
+        if (count <= grain) {
+            std::for_each(first, first + count, std::ref(function));
+            return;
+        }
+
+        const std::ptrdiff_t half = count / 2;
+        pool.invoke(
+            [&] { detail::parallel_for_each(pool, first, half, function, grain); },
+            [&] { detail::parallel_for_each(pool, first + half, count - half, function, grain); });
+    }
+
+    // Reduction of a non empty range - the right half has no initial value
+    template<typename T, typename TIterator, typename TReduce, typename TTransform>
+    T parallel_transform_reduce(thread_pool &pool, TIterator first, std::ptrdiff_t count, TReduce &reduce, TTransform &transform, std::ptrdiff_t grain) {
+        if (count <= grain) {
+            T init = transform(*first);
+            return std::transform_reduce(first + 1, first + count, std::move(init), std::ref(reduce), std::ref(transform));
+        }
+
+        const std::ptrdiff_t half = count / 2;
+        std::optional<T> left;
+        std::optional<T> right;
+        pool.invoke(
+            [&] { left.emplace(detail::parallel_transform_reduce<T>(pool, first, half, reduce, transform, grain)); },
+            [&] { right.emplace(detail::parallel_transform_reduce<T>(pool, first + half, count - half, reduce, transform, grain)); });
+        return reduce(std::move(*left), std::move(*right));
+    }
+
+    // Quicksort with three way partitioning, the partitions are sorted in parallel
+    // Falls back to `std::sort` for small ranges and too deep recursions (degenerated pivots)
+    template<typename TIterator, typename TCompare>
+    void parallel_sort(thread_pool &pool, TIterator first, TIterator last, TCompare &compare, std::ptrdiff_t grain, int depth) {
+        const std::ptrdiff_t count = last - first;
+        if (count <= grain || depth == 0) {
+            std::sort(first, last, std::ref(compare));
+            return;
+        }
+
+        typedef std::remove_cv_t<typename std::iterator_traits<TIterator>::value_type> value_type;
+        const value_type &a = *first;
+        const value_type &b = *(first + count / 2);
+        const value_type &c = *(last - 1);
+        const value_type pivot = compare(a, b) ? (compare(b, c) ? b : (compare(a, c) ? c : a)) : (compare(a, c) ? a : (compare(b, c) ? c : b));
+
+        const TIterator lower = std::partition(first, last, [&](const value_type &element) { return compare(element, pivot); });
+        const TIterator upper = std::partition(lower, last, [&](const value_type &element) { return !compare(pivot, element); });
+
+        pool.invoke(
+            [&] { detail::parallel_sort(pool, first, lower, compare, grain, depth - 1); },
+            [&] { detail::parallel_sort(pool, upper, last, compare, grain, depth - 1); });
+    }
+
+} // namespace detail
+
+// *** Algorithms ***
+// `grain` is the number of elements processed sequentially by one task, 0 selects it from the thread count
+
+template<typename TIterator, typename TFunction>
+void parallel_for_each(thread_pool &pool, TIterator first, TIterator last, TFunction function, std::ptrdiff_t grain = 0) {
+    static_assert(detail::is_random_access_iterator<TIterator>, "parallel_for_each() requires random access iterators");
+    const std::ptrdiff_t count = last - first;
+    if (count > 0) {
+        detail::parallel_for_each(pool, first, count, function, detail::grain_size(pool, count, grain));
+    }
+}
+
+template<typename TIterator, typename TFunction>
+void parallel_for_each(TIterator first, TIterator last, TFunction function, std::ptrdiff_t grain = 0) {
+    tmc::foundation::parallel_for_each(thread_pool::default_pool(), first, last, std::move(function), grain);
+}
+
+// `reduce` must be associative and commutative like for `std::transform_reduce`
+template<typename TIterator, typename T, typename TReduce, typename TTransform>
+T parallel_transform_reduce(thread_pool &pool, TIterator first, TIterator last, T init, TReduce reduce, TTransform transform, std::ptrdiff_t grain = 0) {
+    static_assert(detail::is_random_access_iterator<TIterator>, "parallel_transform_reduce() requires random access iterators");
+    const std::ptrdiff_t count = last - first;
+    if (count <= 0) {
+        return init;
+    }
+
+    T result = detail::parallel_transform_reduce<T>(pool, first, count, reduce, transform, detail::grain_size(pool, count, grain));
+    return reduce(std::move(init), std::move(result));
+}
+
+template<typename TIterator, typename T, typename TReduce, typename TTransform>
+T parallel_transform_reduce(TIterator first, TIterator last, T init, TReduce reduce, TTransform transform, std::ptrdiff_t grain = 0) {
+    return tmc::foundation::parallel_transform_reduce(thread_pool::default_pool(), first, last, std::move(init), std::move(reduce), std::move(transform), grain);
+}
+
+template<typename TIterator, typename TCompare = std::less<>>
+void parallel_sort(thread_pool &pool, TIterator first, TIterator last, TCompare compare = TCompare(), std::ptrdiff_t grain = 0) {
+    static_assert(detail::is_random_access_iterator<TIterator>, "parallel_sort() requires random access iterators");
+    const std::ptrdiff_t count = last - first;
+    if (count <= 1) {
+        return;
+    }
+
+    int depth = 0;
+    for (std::ptrdiff_t size = count; size > 0; size >>= 1) {
+        depth += 2;
+    }
+
+    detail::parallel_sort(pool, first, last, compare, detail::grain_size(pool, count, grain), depth);
+}
+
+template<typename TIterator, typename TCompare = std::less<>>
+void parallel_sort(TIterator first, TIterator last, TCompare compare = TCompare(), std::ptrdiff_t grain = 0) {
+    tmc::foundation::parallel_sort(thread_pool::default_pool(), first, last, std::move(compare), grain);
+}
+
+} // namespace foundation
+}  // namespace tmc
+#endif
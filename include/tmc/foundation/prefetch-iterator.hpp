@@ -0,0 +1,191 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_prefetch_iterator_hpp_
+#define _tmc_foundation_prefetch_iterator_hpp_
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "custom-iterator-template.hpp"
+
+// Prefetching iterator states - a decorator for any iterator state, prefetching the element `Distance` steps ahead
+// - random access states: the address of `at(Distance)`, bounded by the end position
+// - forward / bidirectional states: a lookahead state walks `Distance` steps ahead of the current position. It does not
+//   hide the latency of a pointer chase: node based states (lists, trees, hash chains) still wait for every next pointer,
+//   now on the lookahead, only the further cache lines of large elements are fetched early.
+// `next()` issues the prefetch, `prev()` keeps the lookahead in sync. The elements must be addressable (no proxy references).
+//
+//   template<bool is_const>
+//   using prefetching_iterator_state = tmc::foundation::prefetch_state<iterator_state, 8, is_const>;
+//   SETUP_RANGE_ITERATORS(prefetching_iterator_state);
+
+namespace tmc {
+namespace foundation {
+
+// Cache line size assumed for the prefetches
+inline constexpr std::size_t prefetch_line_size = 64;
+
+// Cache lines prefetched per element at most
+inline constexpr std::size_t prefetch_max_lines = 4;
+
+namespace detail {
+
+    // Prefetches the cache lines of the element at `address` for reading
+    template<typename T>
+    inline void prefetch_element(const T * address) {
+#if defined(__GNUC__) || defined(__clang__)
+        constexpr std::size_t size = sizeof(T) < prefetch_line_size * prefetch_max_lines ? sizeof(T) : prefetch_line_size * prefetch_max_lines;
+        const char *bytes = reinterpret_cast<const char *>(address);
+        for (std::size_t offset = 0; offset < size; offset += prefetch_line_size) {
+            __builtin_prefetch(bytes + offset, 0, 3);
+        }
+#else
+        static_cast<void>(address);
+#endif
+    }
+
+    // Lookahead of non random access states: `lead_` steps ahead of the current position, less at the end
+    template<typename TState, bool is_random_access>
+    struct prefetch_lookahead {
+        inline prefetch_lookahead() = default;
+        inline explicit prefetch_lookahead(typename TState::container_type * container): ahead_(container) {}
+
+        template<typename TOtherState>
+        inline prefetch_lookahead(const prefetch_lookahead<TOtherState, is_random_access> & source): ahead_(source.ahead_), lead_(source.lead_) {}
+
+        // Restarts the lookahead at `current` - copy constructed, the decorated state needs no copy assignment
+        inline void restart(const TState & current) {
+            ahead_.~TState();
+            ::new (static_cast<void *>(std::addressof(ahead_))) TState(current);
+            lead_ = 0;
+        }
+
+        TState ahead_;
+        std::size_t lead_{0};
+    };
+
+    // Random access states compute the prefetch address, no lookahead
+    template<typename TState>
+    struct prefetch_lookahead<TState, true> {
+        inline prefetch_lookahead() = default;
+        inline explicit prefetch_lookahead(typename TState::container_type *) {}
+
+        template<typename TOtherState>
+        inline prefetch_lookahead(const prefetch_lookahead<TOtherState, true> &) {}
+    };
+
+} // namespace detail
+
+// Decorator state: `TIteratorState<is_const>` with prefetches `Distance` elements ahead
+// The hooks of the decorated state are inherited, the iterator category is unchanged. Not inherited: `next_chunk()`
+// (it would move the state without the lookahead) and the `collapses_to_pointer` / `copies_share_position` flags.
+template<template<bool> typename TIteratorState, std::size_t Distance, bool is_const>
+struct prefetch_state:
+    TIteratorState<is_const>,
+    detail::prefetch_lookahead<TIteratorState<is_const>, std::is_base_of<std::random_access_iterator_tag, typename TIteratorState<is_const>::iterator_category>::value> {
+
+    static_assert(Distance > 0, "Prefetch distance must be positive");
+    static_assert(std::is_base_of<std::forward_iterator_tag, typename TIteratorState<is_const>::iterator_category>::value, "Prefetching needs multi pass states, the lookahead is a copy of the state");
+
+    typedef TIteratorState<is_const> state_type;
+    typedef typename state_type::container_type container_type;
+    static constexpr bool is_random_access = std::is_base_of<std::random_access_iterator_tag, typename state_type::iterator_category>::value;
+    typedef detail::prefetch_lookahead<state_type, is_random_access> lookahead_type;
+
+    static_assert(std::is_lvalue_reference<typename detail::state_reference<state_type>::type>::value, "Prefetching needs element references, proxy references are not supported");
+
+    // The prefetches and the end position are part of the state, a collapsed iterator would drop them
+    static constexpr bool collapses_to_pointer = false;
+
+    // Copies are independent positions (forward iterators)
+    static constexpr bool copies_share_position = false;
+
+    // End position - bounds the lookahead
+    state_type last_;
+
+    // Default Construction without container connection (ALL Iterators)
+    inline prefetch_state() = default;
+
+    // Construction with connected container (ALL Iterators)
+    inline prefetch_state(container_type * container): state_type(container), lookahead_type(container), last_(container) {}
+
+    // Copy Construction (ALL Iterators)
+    inline prefetch_state(const prefetch_state & source) = default;
+    inline prefetch_state & operator=(const prefetch_state & source) = default;
+
+    // Copy Construction from the changeable variant (ALL Iterators)
+    template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+    inline prefetch_state(const prefetch_state<TIteratorState, Distance, other_is_const> & source):
+        state_type(static_cast<const TIteratorState<other_is_const> &>(source)),
+        lookahead_type(static_cast<const typename prefetch_state<TIteratorState, Distance, other_is_const>::lookahead_type &>(source)),
+        last_(source.last_) {}
+
+    // Start and End Positions - the lookahead runs ahead of `begin()` (ALL Iterators)
+    inline void begin() {
+        state_type::begin();
+        last_.end();
+        if constexpr (!is_random_access) {
+            this->restart(*this);
+            while (this->lead_ < Distance && !this->ahead_.is_equal(last_)) {
+                this->ahead_.next();
+                ++this->lead_;
+                prefetch_ahead();
+            }
+        }
+    }
+
+    inline void end() {
+        state_type::end();
+        last_.end();
+        if constexpr (!is_random_access) {
+            this->restart(*this);
+        }
+    }
+
+    // Move Next - moves the lookahead and prefetches its element (ALL Iterators)
+    inline void next() {
+        state_type::next();
+        if constexpr (is_random_access) {
+            if (last_.distance(*this) > static_cast<std::ptrdiff_t>(Distance)) {
+                detail::prefetch_element(std::addressof(state_type::at(static_cast<std::ptrdiff_t>(Distance))));
+            }
+        } else {
+            if (this->ahead_.is_equal(last_)) {
+                --this->lead_;
+            } else {
+                this->ahead_.next();
+                prefetch_ahead();
+            }
+        }
+    }
+
+    // Move Previous - the lookahead follows unless it waits at the end (Bidirectional, Random Access Iterators)
+    inline void prev() {
+        state_type::prev();
+        if constexpr (!is_random_access) {
+            if (this->lead_ == Distance) {
+                this->ahead_.prev();
+            } else {
+                ++this->lead_;
+            }
+        }
+    }
+
+    // Batches are handed out element by element, the lookahead follows every step (Chunked Access)
+    void next_chunk(std::ptrdiff_t) = delete;
+
+    private:
+    inline void prefetch_ahead() {
+        if (!this->ahead_.is_equal(last_)) {
+            detail::prefetch_element(std::addressof(this->ahead_.get()));
+        }
+    }
+};
+
+} // namespace foundation
+}  // namespace tmc
+
+#endif
@@ -0,0 +1,82 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT 
+
+#ifndef _tmc_foundation_segmented_iterator_hpp_
+#define _tmc_foundation_segmented_iterator_hpp_
+
+#include <type_traits>
+#include "custom-iterator-template.hpp"
+
+// Segmented iterator protocol - optional extension of the iterator state for chunked containers (fixed blocks plus index)
+// The state implements:
+// - `typedef ... segment_iterator;`                                  - iterates the segments, e.g. a pointer into a block table
+// - `typedef ... local_iterator;`                                    - iterates the elements of a segment, e.g. `value_type *`
+// - `segment_iterator segment() const`                               - segment of the current position
+// - `local_iterator local() const`                                   - current position inside the segment
+// - `local_iterator segment_begin(segment_iterator segment) const`   - first element of a segment
+// - `local_iterator segment_end(segment_iterator segment) const`     - behind the last element of a segment
+// - `void compose(segment_iterator segment, local_iterator local)`   - move to a segment position (`segment_end()` included)
+// `segment_begin()` must be valid for the segment of the end position.
+//
+// The algorithms of algorithms.hpp run a tight loop per segment instead of a block boundary check in every `next()`.
+
+namespace tmc {
+namespace foundation {
+
+template<typename TIterator, typename = void>
+struct segmented_iterator_traits {
+    static constexpr bool is_segmented = false;
+};
+
+template<template<bool> typename TIteratorState, bool is_const, typename TCheckPolicy, typename TInstrumentation>
+struct segmented_iterator_traits<custom_iterator_template<TIteratorState, is_const, TCheckPolicy, TInstrumentation>, std::void_t<typename TIteratorState<is_const>::segment_iterator>> {
+    static constexpr bool is_segmented = true;
+
+    typedef custom_iterator_template<TIteratorState, is_const, TCheckPolicy, TInstrumentation> iterator;
+    typedef typename TIteratorState<is_const>::segment_iterator         segment_iterator;
+    typedef typename TIteratorState<is_const>::local_iterator           local_iterator;
+
+    static inline segment_iterator segment(const iterator &it) { return custom_iterator_access::state(it).segment(); }
+    static inline local_iterator local(const iterator &it) { return custom_iterator_access::state(it).local(); }
+    static inline local_iterator begin(const iterator &it, segment_iterator segment) { return custom_iterator_access::state(it).segment_begin(segment); }
+    static inline local_iterator end(const iterator &it, segment_iterator segment) { return custom_iterator_access::state(it).segment_end(segment); }
+
+    // Iterator at a segment position, `it` provides the container connection
+    static inline iterator compose(iterator it, segment_iterator segment, local_iterator local) {
+        custom_iterator_access::state(it).compose(segment, local);
+        return it;
+    }
+};
+
+namespace detail {
+
+    // Calls `process(segment, localFirst, localLast)` for the part of each segment within [first, last), stops when it returns false
+    template<typename TIterator, typename TProcess>
+    inline void for_each_segment(const TIterator &first, const TIterator &last, TProcess process) {
+        typedef segmented_iterator_traits<TIterator> traits;
+
+        auto segment = traits::segment(first);
+        const auto lastSegment = traits::segment(last);
+        if (segment == lastSegment) {
+            process(segment, traits::local(first), traits::local(last));
+            return;
+        }
+
+        if (!process(segment, traits::local(first), traits::end(first, segment))) {
+            return;
+        }
+
+        for (++segment; segment != lastSegment; ++segment) {
+            if (!process(segment, traits::begin(first, segment), traits::end(first, segment))) {
+                return;
+            }
+        }
+
+        process(segment, traits::begin(first, segment), traits::local(last));
+    }
+
+} // namespace detail
+
+} // namespace foundation
+}  // namespace tmc
+#endif
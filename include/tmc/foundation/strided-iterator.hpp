@@ -0,0 +1,176 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_strided_iterator_hpp_
+#define _tmc_foundation_strided_iterator_hpp_
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include "custom-iterator-template.hpp"
+#include "custom-iterator-template-helper.hpp"
+
+// Strided iterators - one field of an array of structs (AoS) as random access range
+// The state is a byte pointer: `next()` adds the stride, `move()` / `at()` scale the offset by the stride.
+// With a compile time stride the arithmetic folds into the addressing modes like a hand written pointer loop.
+//
+//   SampleElement elements[100];
+//   for (int &member: tmc::foundation::make_field_range(elements, 100, &SampleElement::member_)) { ... }
+
+namespace tmc {
+namespace foundation {
+
+// Stride argument of `strided_range` / `strided_state` for a stride given at runtime
+inline constexpr std::ptrdiff_t dynamic_stride = 0;
+
+template<typename T, std::ptrdiff_t Stride = dynamic_stride>
+class strided_range;
+
+namespace detail {
+
+    // Compile time stride - empty, the stride is not stored
+    template<std::ptrdiff_t Stride>
+    struct stride_holder {
+        static_assert(Stride > 0, "Stride must be positive");
+
+        inline stride_holder() = default;
+        inline explicit stride_holder(std::ptrdiff_t) {}
+        static constexpr std::ptrdiff_t stride() { return Stride; }
+    };
+
+    // Runtime stride
+    template<>
+    struct stride_holder<dynamic_stride> {
+        inline stride_holder() = default;
+        inline explicit stride_holder(std::ptrdiff_t stride): stride_(stride) {}
+        inline std::ptrdiff_t stride() const { return stride_; }
+
+        std::ptrdiff_t stride_{1};
+    };
+
+} // namespace detail
+
+// Iterator state of `strided_range<T, Stride>` - Stride is given in bytes
+template<typename T, std::ptrdiff_t Stride, bool is_const>
+struct strided_state: detail::stride_holder<Stride> {
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef typename std::conditional<is_const, const strided_range<T, Stride>, strided_range<T, Stride>>::type container_type;
+    typedef typename std::conditional<is_const, const T, T>::type value_type;
+    typedef typename std::conditional<std::is_const<value_type>::value, const char, char>::type byte_type;
+
+    // Unconnected states have a null position, equal to the positions of empty spans with a null `data()` only
+    static constexpr bool compares_unconnected = true;
+
+    // The range is only accessed in `begin()` / `end()`: the iterators outlive the range object (borrowed range)
+    container_type * container_{nullptr};
+    byte_type * current_{nullptr};
+
+    // Default Construction without container connection (ALL Iterators)
+    inline strided_state() = default;
+
+    // Construction with connected container (ALL Iterators)
+    inline strided_state(container_type * container): detail::stride_holder<Stride>(container->stride()), container_(container) {}
+
+    // Copy Construction - defaulted to keep the state trivially copyable (ALL Iterators)
+    inline strided_state(const strided_state & source) = default;
+
+    // Copy Construction from the changeable variant (ALL Iterators)
+    template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+    inline strided_state(const strided_state<T, Stride, other_is_const> & source): detail::stride_holder<Stride>(source.stride()), container_(source.container_), current_(source.current_) {}
+
+    // Start and End Positions (ALL Iterators)
+    inline void begin() { current_ = reinterpret_cast<byte_type *>(container_->data()); }
+    inline void end() { current_ = reinterpret_cast<byte_type *>(container_->data()) + static_cast<std::ptrdiff_t>(container_->size()) * this->stride(); }
+
+    // Availability and Equality (ALL Iterators)
+    inline bool is_connected() const { return container_ != nullptr; }
+
+    template<bool other_is_const>
+    inline bool is_equal(const strided_state<T, Stride, other_is_const> & other) const { return current_ == other.current_; }
+
+    // Move Next (ALL Iterators)
+    inline void next() { current_ += this->stride(); }
+
+    // Element Access (ALL Iterators)
+    inline value_type & get() const { return *reinterpret_cast<value_type *>(current_); }
+
+    // Move Previous (Bidirectional, Random Access Iterators)
+    inline void prev() { current_ -= this->stride(); }
+
+    // Move to position (Random Access Iterators)
+    inline void move(std::ptrdiff_t offset) { current_ += offset * this->stride(); }
+
+    // Calculate Distance (Random Access Iterators)
+    template<bool other_is_const>
+    inline std::ptrdiff_t distance(const strided_state<T, Stride, other_is_const> & rhs) const { return (current_ - rhs.current_) / this->stride(); }
+
+    // Element access at position (Random Access Iterators)
+    inline value_type & at(std::ptrdiff_t offset) const { return *reinterpret_cast<value_type *>(current_ + offset * this->stride()); }
+};
+
+// Non owning range over `count` elements of type `T`, each `Stride` bytes after the previous one
+// `Stride` is a compile time constant or `dynamic_stride` for a stride given to the constructor
+template<typename T, std::ptrdiff_t Stride>
+class strided_range: detail::stride_holder<Stride> {
+    template<bool is_const>
+    using iterator_state = strided_state<T, Stride, is_const>;
+
+    public:
+    typedef T value_type;
+
+    inline strided_range() = default;
+
+    // Compile time stride
+    template<std::ptrdiff_t S = Stride, typename std::enable_if<S != dynamic_stride, int>::type = 0>
+    inline strided_range(T * first, std::size_t count): first_(first), count_(count) {}
+
+    // Runtime stride in bytes - a zero stride throws `std::invalid_argument`
+    template<std::ptrdiff_t S = Stride, typename std::enable_if<S == dynamic_stride, int>::type = 0>
+    inline strided_range(T * first, std::size_t count, std::ptrdiff_t stride): detail::stride_holder<Stride>(checked_stride(stride)), first_(first), count_(count) {}
+
+    inline T * data() const { return first_; }
+    inline std::size_t size() const { return count_; }
+    inline bool empty() const { return count_ == 0; }
+    using detail::stride_holder<Stride>::stride;
+
+    SETUP_RANGE_ITERATORS(iterator_state);
+    SETUP_REVERSE_ITERATORS(iterator_state);
+
+    private:
+    // The distance of two positions is their byte distance divided by the stride
+    static std::ptrdiff_t checked_stride(std::ptrdiff_t stride) {
+        if (stride == 0) { throw std::invalid_argument("The stride must not be zero"); }
+        return stride;
+    }
+
+    T * first_{nullptr};
+    std::size_t count_{0};
+};
+
+// Field `member` of `count` structs starting at `elements` - the stride is `sizeof(TStruct)` at compile time
+template<typename TStruct, typename TField>
+inline strided_range<TField, static_cast<std::ptrdiff_t>(sizeof(TStruct))> make_field_range(TStruct * elements, std::size_t count, TField TStruct::* member) {
+    return strided_range<TField, static_cast<std::ptrdiff_t>(sizeof(TStruct))>(count > 0 ? &(elements->*member) : nullptr, count);
+}
+
+template<typename TStruct, typename TField>
+inline strided_range<const TField, static_cast<std::ptrdiff_t>(sizeof(TStruct))> make_field_range(const TStruct * elements, std::size_t count, TField TStruct::* member) {
+    return strided_range<const TField, static_cast<std::ptrdiff_t>(sizeof(TStruct))>(count > 0 ? &(elements->*member) : nullptr, count);
+}
+
+} // namespace foundation
+}  // namespace tmc
+
+// Strided ranges are views and borrowed ranges (C++20)
+#if __cplusplus >= 202002L
+namespace std::ranges {
+    template<typename T, std::ptrdiff_t Stride>
+    inline constexpr bool enable_view<tmc::foundation::strided_range<T, Stride>> = true;
+
+    template<typename T, std::ptrdiff_t Stride>
+    inline constexpr bool enable_borrowed_range<tmc::foundation::strided_range<T, Stride>> = true;
+}
+#endif
+
+#endif
@@ -0,0 +1,170 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_foundation_zip_iterator_hpp_
+#define _tmc_foundation_zip_iterator_hpp_
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "custom-iterator-template.hpp"
+#include "custom-iterator-template-helper.hpp"
+
+// Zip iterators - advance any number of iterators (custom iterators, pointers, std iterators) in lockstep
+// - the first range designates the end: comparisons and distances only look at the first iterator,
+//   the other ranges must be at least as long (exactly as long for backward iteration from `end()`)
+// - the category is the weakest category of the zipped iterators, at most random access
+// - dereferencing yields a `std::tuple` of the element references
+//
+//   for (auto [key, value]: tmc::foundation::make_zip_range(keys, values)) { ... }
+
+namespace tmc {
+namespace foundation {
+
+template<typename... TIterators>
+class zip_range;
+
+namespace detail {
+
+    // Weakest category of the zipped iterators - contiguous iterators count as random access
+    template<typename... TIterators>
+    using zip_iterator_category = typename std::common_type<detail::legacy_iterator_category<typename std::iterator_traits<TIterators>::iterator_category>...>::type;
+
+    // Trivially copyable tuple of the zipped iterators (`std::tuple` is not trivially copyable)
+    template<std::size_t index, typename TIterator>
+    struct zip_element {
+        TIterator iterator_;
+    };
+
+    template<typename TIndices, typename... TIterators>
+    struct zip_iterators;
+
+    template<std::size_t... indices, typename... TIterators>
+    struct zip_iterators<std::index_sequence<indices...>, TIterators...>: zip_element<indices, TIterators>... {
+
+        // Iterator designating the end
+        inline const auto & first() const { return static_cast<const zip_element<0, std::tuple_element_t<0, std::tuple<TIterators...>>> &>(*this).iterator_; }
+
+        // Calls `function(iterators...)`
+        template<typename TFunction>
+        inline decltype(auto) apply(TFunction && function) {
+            return function(static_cast<zip_element<indices, TIterators> &>(*this).iterator_...);
+        }
+
+        template<typename TFunction>
+        inline decltype(auto) apply(TFunction && function) const {
+            return function(static_cast<const zip_element<indices, TIterators> &>(*this).iterator_...);
+        }
+    };
+
+} // namespace detail
+
+// Iterator state of `zip_range<TIterators...>`
+// The constness of the elements follows the zipped iterators, `is_const` only selects the container type
+template<bool is_const, typename... TIterators>
+struct zip_state {
+    static_assert(sizeof...(TIterators) > 0, "At least one iterator must be zipped");
+
+    typedef detail::zip_iterator_category<TIterators...> iterator_category;
+    typedef typename std::conditional<is_const, const zip_range<TIterators...>, zip_range<TIterators...>>::type container_type;
+    typedef std::tuple<std::remove_cv_t<typename std::iterator_traits<TIterators>::value_type>...> value_type;
+    typedef std::tuple<typename std::iterator_traits<TIterators>::reference...> reference;
+
+    // Unconnected states hold value initialized iterators, the comparison of the first one is correct for them
+    static constexpr bool compares_unconnected = true;
+
+    typedef detail::zip_iterators<std::index_sequence_for<TIterators...>, TIterators...> iterators_type;
+
+    container_type * container_{nullptr};
+    iterators_type iterators_{};
+
+    // Default Construction without container connection (ALL Iterators)
+    inline zip_state() = default;
+
+    // Construction with connected container (ALL Iterators)
+    inline zip_state(container_type * container): container_(container) {}
+
+    // Copy Construction - defaulted, the state is trivially copyable if the zipped iterators are (ALL Iterators)
+    inline zip_state(const zip_state & source) = default;
+
+    // Copy Construction from the changeable variant (ALL Iterators)
+    template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+    inline zip_state(const zip_state<other_is_const, TIterators...> & source): container_(source.container_), iterators_(source.iterators_) {}
+
+    // Start and End Positions (ALL Iterators)
+    inline void begin() { iterators_ = container_->first_; }
+    inline void end() { iterators_ = container_->last_; }
+
+    // Availability and Equality - the first iterator designates the end (ALL Iterators)
+    inline bool is_connected() const { return container_ != nullptr; }
+
+    template<bool other_is_const>
+    inline bool is_equal(const zip_state<other_is_const, TIterators...> & other) const { return iterators_.first() == other.iterators_.first(); }
+
+    // Move Next (ALL Iterators)
+    inline void next() { iterators_.apply([](auto &... iterators) { (++iterators, ...); }); }
+
+    // Element Access (ALL Iterators)
+    inline reference get() const { return iterators_.apply([](const auto &... iterators) { return reference(*iterators...); }); }
+
+    // Move Previous (Bidirectional, Random Access Iterators)
+    inline void prev() { iterators_.apply([](auto &... iterators) { (--iterators, ...); }); }
+
+    // Move to position (Random Access Iterators)
+    inline void move(std::ptrdiff_t offset) { iterators_.apply([offset](auto &... iterators) { ((iterators += offset), ...); }); }
+
+    // Calculate Distance (Random Access Iterators)
+    template<bool other_is_const>
+    inline std::ptrdiff_t distance(const zip_state<other_is_const, TIterators...> & rhs) const { return iterators_.first() - rhs.iterators_.first(); }
+
+    // Element access at position (Random Access Iterators)
+    inline reference at(std::ptrdiff_t offset) const { return iterators_.apply([offset](const auto &... iterators) { return reference(iterators[offset]...); }); }
+};
+
+// Range over zipped iterators, non owning
+template<typename... TIterators>
+class zip_range {
+    template<bool is_const>
+    using iterator_state = zip_state<is_const, TIterators...>;
+
+    template<bool, typename...>
+    friend struct zip_state;
+
+    public:
+    typedef detail::zip_iterators<std::index_sequence_for<TIterators...>, TIterators...> iterators_type;
+
+    inline zip_range() = default;
+    inline zip_range(const iterators_type & first, const iterators_type & last): first_(first), last_(last) {}
+
+    SETUP_RANGE_ITERATORS(iterator_state);
+
+    private:
+    iterators_type first_{};
+    iterators_type last_{};
+};
+
+// Zips the ranges (containers with `begin()` / `end()` returning iterators, arrays), the first range designates the end
+template<typename... TRanges>
+inline zip_range<decltype(std::begin(std::declval<TRanges &>()))...> make_zip_range(TRanges &... ranges) {
+    static_assert((std::is_same<decltype(std::begin(std::declval<TRanges &>())), decltype(std::end(std::declval<TRanges &>()))>::value && ...), "Zipped ranges must return the same type from begin() and end()");
+    typedef zip_range<decltype(std::begin(std::declval<TRanges &>()))...> range_type;
+    return range_type(typename range_type::iterators_type{{std::begin(ranges)}...}, typename range_type::iterators_type{{std::end(ranges)}...});
+}
+
+} // namespace foundation
+}  // namespace tmc
+
+// Zip ranges are views and borrowed ranges (C++20)
+#if __cplusplus >= 202002L
+namespace std::ranges {
+    template<typename... TIterators>
+    inline constexpr bool enable_view<tmc::foundation::zip_range<TIterators...>> = true;
+
+    template<typename... TIterators>
+    inline constexpr bool enable_borrowed_range<tmc::foundation::zip_range<TIterators...>> = true;
+}
+#endif
+
+#endif
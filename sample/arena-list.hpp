@@ -0,0 +1,234 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_sample_arena_list_hpp_
+#define _tmc_sample_arena_list_hpp_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <tmc/foundation/custom-iterator-template-helper.hpp>
+
+// Doubly linked list allocating its nodes from a `std::pmr::memory_resource`
+// - default: an own arena (`std::pmr::monotonic_buffer_resource`), node allocation is a pointer bump, erased nodes
+//   are released with the arena
+// - any other resource, e.g. `std::pmr::new_delete_resource()` for one heap allocation per node
+// `compact()` copies the nodes in traversal order into a new arena: iteration becomes a sequential memory scan.
+// The list is circular around a sentinel node, `end()` is the sentinel: `--end()` is the last element.
+template<typename T>
+class ArenaList{
+
+    struct NodeLinks {
+        NodeLinks *next_;
+        NodeLinks *prev_;
+    };
+
+    struct Node: NodeLinks {
+        T value_;
+
+        template<typename... TArguments>
+        Node(TArguments &&... arguments): NodeLinks{nullptr, nullptr}, value_(std::forward<TArguments>(arguments)...) {}
+    };
+
+    template<bool is_const>
+    struct iterator_state;
+
+    public:
+    // `resource == nullptr` allocates from an own arena
+    explicit ArenaList(std::pmr::memory_resource *resource = nullptr):
+        arena_(resource == nullptr ? std::make_unique<std::pmr::monotonic_buffer_resource>() : nullptr),
+        resource_(resource == nullptr ? arena_.get() : resource) {}
+
+    ArenaList(std::initializer_list<T> values, std::pmr::memory_resource *resource = nullptr): ArenaList(resource) {
+        for (const auto &value: values) {
+            push_back(value);
+        }
+    }
+
+    ArenaList(const ArenaList &) = delete;
+    ArenaList & operator=(const ArenaList &) = delete;
+
+    ~ArenaList() { clear(); }
+
+    void push_back(const T &value) { link(&head_, create(value)); }
+    void push_front(const T &value) { link(head_.next_, create(value)); }
+
+    // Inserts `value` before `position`, returns an iterator to the new element
+    template<typename TIterator>
+    TIterator insert(TIterator position, const T &value) {
+        NodeLinks *node = create(value);
+        link(tmc::foundation::custom_iterator_access::state(position).node_, node);
+        tmc::foundation::custom_iterator_access::state(position).prev();
+        return position;
+    }
+
+    // Removes the element at `position`, returns an iterator to the next element
+    // Invalidates all iterators of checked builds, the result is positioned anew and records the new generation
+    template<typename TIterator>
+    TIterator erase(TIterator position) {
+        NodeLinks *node = tmc::foundation::custom_iterator_access::state(position).node_;
+        NodeLinks *next = node->next_;
+        unlink(node);
+        destroy(static_cast<Node *>(node));
+        ++generation_;
+
+        TIterator result = TIterator::end(this);
+        tmc::foundation::custom_iterator_access::state(result).node_ = next;
+        return result;
+    }
+
+    void clear() {
+        while (head_.next_ != &head_) {
+            NodeLinks *node = head_.next_;
+            unlink(node);
+            destroy(static_cast<Node *>(node));
+        }
+        ++generation_;
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    // Moves the elements in traversal order into a new arena sized for all nodes and releases the old nodes
+    // Invalidates all iterators. Afterwards the list allocates from the new arena.
+    // The new list is complete before the old nodes are released: elements with a throwing move constructor are copied,
+    // a throwing copy leaves the list unchanged
+    void compact() {
+        auto arena = std::make_unique<std::pmr::monotonic_buffer_resource>(size_ * sizeof(Node) + alignof(Node));
+
+        NodeLinks head{&head, &head};
+        try {
+            for (NodeLinks *node = head_.next_; node != &head_; node = node->next_) {
+                link(&head, new (arena->allocate(sizeof(Node), alignof(Node))) Node(std::move_if_noexcept(static_cast<Node *>(node)->value_)));
+            }
+        } catch (...) {
+            // The arena releases the memory of the copies
+            for (NodeLinks *copy = head.next_; copy != &head;) {
+                NodeLinks *next = copy->next_;
+                static_cast<Node *>(copy)->~Node();
+                copy = next;
+            }
+            throw;
+        }
+
+        for (NodeLinks *node = head_.next_; node != &head_;) {
+            NodeLinks *next = node->next_;
+            release(static_cast<Node *>(node));
+            node = next;
+        }
+
+        if (head.next_ == &head) {
+            head_.next_ = head_.prev_ = &head_;
+        } else {
+            head_.next_ = head.next_;
+            head_.prev_ = head.prev_;
+            head_.next_->prev_ = &head_;
+            head_.prev_->next_ = &head_;
+        }
+        arena_ = std::move(arena);
+        resource_ = arena_.get();
+        ++generation_;
+    }
+
+    private:
+    NodeLinks * create(const T &value) {
+        Node *node = new (resource_->allocate(sizeof(Node), alignof(Node))) Node(value);
+        ++size_;
+        return node;
+    }
+
+    void destroy(Node *node) {
+        release(node);
+        --size_;
+    }
+
+    void release(Node *node) {
+        node->~Node();
+        resource_->deallocate(node, sizeof(Node), alignof(Node));
+    }
+
+    // Links `node` before `position`
+    static void link(NodeLinks *position, NodeLinks *node) {
+        node->next_ = position;
+        node->prev_ = position->prev_;
+        position->prev_->next_ = node;
+        position->prev_ = node;
+    }
+
+    static void unlink(NodeLinks *node) {
+        node->prev_->next_ = node->next_;
+        node->next_->prev_ = node->prev_;
+    }
+
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> arena_;
+    std::pmr::memory_resource *resource_;
+    NodeLinks head_{&head_, &head_};
+    size_t size_{0};
+    // Modification count - `erase()`, `clear()` and `compact()` release nodes
+    size_t generation_{0};
+
+            template<bool is_const>
+            struct iterator_state {
+                typedef std::bidirectional_iterator_tag iterator_category;
+                typedef typename std::conditional<is_const, const ArenaList, ArenaList>::type        container_type;
+                typedef typename std::conditional<is_const, const T, T>::type                        value_type;
+
+                // Unconnected states have a null node, connected states are at least at the sentinel node
+                static constexpr bool compares_unconnected = true;
+
+                container_type * container_{nullptr};
+                NodeLinks * node_{nullptr};
+
+                // Default Construction without container connection (ALL Iterators)
+                inline iterator_state() = default;
+
+                // Construction with connected container; (ALL Iterators)
+                inline iterator_state(container_type * container): container_(container) {}
+
+                // Copy Construction - defaulted to keep the state trivially copyable (ALL Iterators)
+                inline iterator_state(const iterator_state & source) = default;
+                inline iterator_state & operator=(const iterator_state & source) = default;
+
+                // Copy Construction from the changeable variant (ALL Iterators)
+                template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+                inline iterator_state(const iterator_state<other_is_const> & source): container_(source.container_), node_(source.node_) {}
+
+                // Start and End Positions - the end is the sentinel (ALL Iterators)
+                inline void begin() { node_ = container_->head_.next_; }
+                inline void end() { node_ = const_cast<NodeLinks *>(&container_->head_); }
+
+                // Reverse Start and End Positions - the sentinel is before the first node too (Native Reverse Iterators)
+                inline void rbegin() { node_ = container_->head_.prev_; }
+                inline void rend() { node_ = const_cast<NodeLinks *>(&container_->head_); }
+
+                // Availability and Equality (ALL Iterators)
+                inline bool is_connected() const { return container_ != nullptr; }
+
+                template<bool other_is_const>
+                inline bool is_equal(const iterator_state<other_is_const> & other) const { return node_ == other.node_; }
+
+                // Move Next (ALL Iterators)
+                inline void next() { node_ = node_->next_; }
+
+                // Element Access (ALL Iterators)
+                inline value_type & get() const { return static_cast<Node *>(node_)->value_; }
+
+                // Move Previous (Bidirectional Iterators)
+                inline void prev() { node_ = node_->prev_; }
+
+                // Modification count of the list (Checked Iterators)
+                inline size_t generation() const { return container_->generation_; }
+            };
+
+    public:
+            SETUP_RANGE_ITERATORS(iterator_state);
+            SETUP_REVERSE_ITERATORS(iterator_state);
+};
+
+#endif
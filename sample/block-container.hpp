@@ -0,0 +1,184 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT 
+
+#ifndef _tmc_sample_block_container_hpp_
+#define _tmc_sample_block_container_hpp_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+#include <vector>
+
+#include <tmc/foundation/custom-iterator-template-helper.hpp>
+#include <tmc/foundation/segmented-iterator.hpp>
+
+// Container storing its elements in fixed size blocks (like `std::deque`)
+// The iterator state implements the segmented iterator protocol: the `tmc::foundation` algorithms
+// run a tight loop per block instead of checking the block boundary in every `operator++`
+template<typename T, std::size_t BlockSize = 1024>
+class BlockContainer{
+    static_assert(BlockSize > 0 && (BlockSize & (BlockSize - 1)) == 0, "BlockSize must be a power of 2");
+
+    public:
+    BlockContainer(): blockTable_{nullptr} {}
+    BlockContainer(std::initializer_list<T> values): BlockContainer() {
+        for (const auto &value: values) {
+            push_back(value);
+        }
+    }
+
+    void push_back(const T &value) {
+        if (elementCount_ % BlockSize == 0) {
+            blocks_.push_back(std::make_unique<T[]>(BlockSize));
+            blockTable_.back() = blocks_.back().get();
+            blockTable_.push_back(nullptr);
+        }
+
+        blockTable_[elementCount_ / BlockSize][elementCount_ % BlockSize] = value;
+        ++elementCount_;
+        ++generation_;
+    }
+
+    size_t size() const { return elementCount_; }
+
+    private:
+    std::vector<std::unique_ptr<T[]>> blocks_;
+    // Block addresses followed by a `nullptr` entry: the segment of the end position if the last block is full
+    std::vector<T *> blockTable_;
+    size_t elementCount_{0};
+    // Modification count - `push_back()` may move the block table
+    size_t generation_{0};
+
+            template<bool is_const>
+            struct iterator_state {
+                typedef std::random_access_iterator_tag iterator_category;
+                typedef typename std::conditional<is_const, const BlockContainer, BlockContainer>::type        container_type;
+                typedef typename std::conditional<is_const, const T, T>::type                                  value_type;
+
+                // Segmented iterator protocol: the block table entry and the element pointer inside the block
+                typedef T * const *                                                                           segment_iterator;
+                typedef value_type *                                                                          local_iterator;
+
+                // Unconnected states have a null block, equal to the positions of containers without a block table only
+                static constexpr bool compares_unconnected = true;
+
+                container_type * container_{nullptr};
+                segment_iterator block_{nullptr};
+                std::ptrdiff_t index_{0};
+
+                // Default Construction without container connection (ALL Iterators)
+                inline iterator_state() = default;
+
+                // Construction with connected container; (ALL Iterators)
+                inline iterator_state(container_type * container): container_(container) {}
+
+
+                // Copy Construction - defaulted to keep the state trivially copyable (ALL Iterators)
+                inline iterator_state(const iterator_state & source) = default;
+
+                // Copy Construction from the other variant - allows changeble to const and vice versa assignment (ALL Iterators)
+                inline iterator_state(const iterator_state<!is_const> & source): container_(source.container_), block_(source.block_), index_(source.index_) {}
+
+                // Start and End Positions (ALL Iterators)
+                inline void begin() { set_position(0); }
+                inline void end() { set_position(static_cast<std::ptrdiff_t>(container_->elementCount_)); }
+
+                // Availability and Equality (ALL Iterators)
+                inline bool is_connected() const { return container_ != nullptr; }
+
+                template<bool other_is_const>
+                inline bool is_equal(const iterator_state<other_is_const> & other) const { return block_ == other.block_ && index_ == other.index_; }
+
+
+                // Move Next - checks the block boundary in every step (ALL Iterators)
+                inline void next() {
+                    if (++index_ == static_cast<std::ptrdiff_t>(BlockSize)) {
+                        ++block_;
+                        index_ = 0;
+                    }
+                }
+
+
+                // Element Access (ALL Iterators)
+                inline value_type & get() const { return (*block_)[index_]; }
+
+
+                // Move Previous (Bidirectional, Random Access Iterators)
+                inline void prev() {
+                    if (index_-- == 0) {
+                        --block_;
+                        index_ = BlockSize - 1;
+                    }
+                }
+
+                // Move to position (Random Access Iterators)
+                inline void move(std::ptrdiff_t offset) { set_position(position() + offset); }
+
+                // Calculate Distance (Random Access Iterators)
+                template<bool other_is_const>
+                inline std::ptrdiff_t distance(const iterator_state<other_is_const> & rhs) const { return position() - rhs.position(); }
+
+                // Element access at position (Random Access Iterators)
+                inline value_type & at(std::ptrdiff_t offset) const {
+                    const std::ptrdiff_t target = position() + offset;
+                    return container_->blockTable_[target / BlockSize][target % BlockSize];
+                }
+
+
+                // Segmented Iterator Protocol
+                inline segment_iterator segment() const { return block_; }
+                inline local_iterator local() const { return *block_ + index_; }
+                inline local_iterator segment_begin(segment_iterator segment) const { return *segment; }
+                inline local_iterator segment_end(segment_iterator segment) const { return *segment + BlockSize; }
+
+                inline void compose(segment_iterator segment, local_iterator local) {
+                    block_ = segment;
+                    index_ = local - *segment;
+                    if (index_ == static_cast<std::ptrdiff_t>(BlockSize)) {
+                        ++block_;
+                        index_ = 0;
+                    }
+                }
+
+
+#if __cplusplus >= 202002L
+                // Chunked Access - the rest of the current block, at most `max` elements
+                inline std::span<value_type> next_chunk(std::ptrdiff_t max) {
+                    const std::ptrdiff_t blockRemaining = static_cast<std::ptrdiff_t>(BlockSize) - index_;
+                    const std::ptrdiff_t remaining = static_cast<std::ptrdiff_t>(container_->elementCount_) - position();
+                    const std::ptrdiff_t count = std::min(max, std::min(blockRemaining, remaining));
+                    if (count <= 0) {
+                        return {};
+                    }
+
+                    std::span<value_type> chunk(*block_ + index_, static_cast<std::size_t>(count));
+                    compose(block_, *block_ + index_ + count);
+                    return chunk;
+                }
+#endif
+
+
+                // Modification count of the container (Checked Iterators)
+                inline size_t generation() const { return container_->generation_; }
+
+
+                // Absolute element position
+                inline std::ptrdiff_t position() const { return (block_ - container_->blockTable_.data()) * static_cast<std::ptrdiff_t>(BlockSize) + index_; }
+
+                inline void set_position(std::ptrdiff_t position) {
+                    block_ = container_->blockTable_.data() + position / static_cast<std::ptrdiff_t>(BlockSize);
+                    index_ = position % static_cast<std::ptrdiff_t>(BlockSize);
+                }
+            };
+
+    public:
+            SETUP_RANGE_ITERATORS(iterator_state);
+            SETUP_REVERSE_ITERATORS(iterator_state);
+};
+
+#endif
@@ -0,0 +1,134 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_sample_linked_node_list_hpp_
+#define _tmc_sample_linked_node_list_hpp_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <tmc/foundation/custom-iterator-template-helper.hpp>
+#include <tmc/foundation/prefetch-iterator.hpp>
+
+// Singly linked list with one heap allocation per node - every `next()` of the iterator chases a pointer
+// `PrefetchDistance > 0` decorates the iterator state with `tmc::foundation::prefetch_state`: a lookahead state walks
+// `PrefetchDistance` nodes ahead and prefetches them
+template<typename T, std::size_t PrefetchDistance = 0>
+class LinkedNodeList{
+
+    struct Node {
+        Node *next_;
+        T value_;
+    };
+
+    public:
+    LinkedNodeList() = default;
+    LinkedNodeList(std::initializer_list<T> values) {
+        for (const auto &value: values) {
+            push_back(value);
+        }
+    }
+
+    LinkedNodeList(const LinkedNodeList &) = delete;
+    LinkedNodeList & operator=(const LinkedNodeList &) = delete;
+
+    ~LinkedNodeList() {
+        while (Node *node = first_) {
+            first_ = node->next_;
+            delete node;
+        }
+    }
+
+    void push_back(const T &value) {
+        Node *node = new Node{nullptr, value};
+        *last_ = node;
+        last_ = &node->next_;
+        ++size_;
+    }
+
+    size_t size() const { return size_; }
+
+    // Relinks the nodes in random order without moving them: the list order no longer follows the allocation order,
+    // like a long lived list with inserts and removals. The values stay in list order.
+    void shuffle_nodes(std::uint32_t seed) {
+        std::vector<Node *> nodes;
+        nodes.reserve(size_);
+        std::vector<T> values;
+        values.reserve(size_);
+        for (Node *node = first_; node != nullptr; node = node->next_) {
+            nodes.push_back(node);
+            values.push_back(node->value_);
+        }
+        std::shuffle(nodes.begin(), nodes.end(), std::mt19937(seed));
+
+        last_ = &first_;
+        for (size_t index = 0; index < nodes.size(); ++index) {
+            nodes[index]->value_ = values[index];
+            *last_ = nodes[index];
+            last_ = &nodes[index]->next_;
+        }
+        *last_ = nullptr;
+    }
+
+    private:
+    Node *first_{nullptr};
+    Node **last_{&first_};
+    size_t size_{0};
+
+            template<bool is_const>
+            struct iterator_state {
+                typedef std::forward_iterator_tag iterator_category;
+                typedef typename std::conditional<is_const, const LinkedNodeList, LinkedNodeList>::type        container_type;
+                typedef typename std::conditional<is_const, const T, T>::type                                  value_type;
+
+                // Unconnected states have a null node like the end position: default constructed iterators equal end iterators
+                static constexpr bool compares_unconnected = true;
+
+                container_type * container_{nullptr};
+                Node * node_{nullptr};
+
+                // Default Construction without container connection (ALL Iterators)
+                inline iterator_state() = default;
+
+                // Construction with connected container; (ALL Iterators)
+                inline iterator_state(container_type * container): container_(container) {}
+
+                // Copy Construction - defaulted to keep the state trivially copyable (ALL Iterators)
+                inline iterator_state(const iterator_state & source) = default;
+                inline iterator_state & operator=(const iterator_state & source) = default;
+
+                // Copy Construction from the changeable variant (ALL Iterators)
+                template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+                inline iterator_state(const iterator_state<other_is_const> & source): container_(source.container_), node_(source.node_) {}
+
+                // Start and End Positions (ALL Iterators)
+                inline void begin() { node_ = container_->first_; }
+                inline void end() { node_ = nullptr; }
+
+                // Availability and Equality (ALL Iterators)
+                inline bool is_connected() const { return container_ != nullptr; }
+
+                template<bool other_is_const>
+                inline bool is_equal(const iterator_state<other_is_const> & other) const { return node_ == other.node_; }
+
+                // Move Next (ALL Iterators)
+                inline void next() { node_ = node_->next_; }
+
+                // Element Access (ALL Iterators)
+                inline value_type & get() const { return node_->value_; }
+            };
+
+            template<bool is_const>
+            using selected_iterator_state = typename std::conditional<PrefetchDistance == 0, iterator_state<is_const>, tmc::foundation::prefetch_state<iterator_state, (PrefetchDistance > 0 ? PrefetchDistance : 1), is_const>>::type;
+
+    public:
+            SETUP_RANGE_ITERATORS(selected_iterator_state);
+};
+
+#endif
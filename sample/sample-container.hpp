@@ -0,0 +1,101 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT 
+
+#ifndef _tmc_sample_sample_container_hpp_
+#define _tmc_sample_sample_container_hpp_
+
+#include <cstddef>
+#include <type_traits>
+
+#include <tmc/foundation/custom-iterator-template-helper.hpp>
+
+struct SampleElement{
+    int member_;
+};
+
+// Non owning container over an element array: a view and a borrowed range in C++20
+class SampleContainer{
+
+    public:
+    SampleContainer(SampleElement * elements, size_t elementCount): elements_{elements}, elementCount_{elementCount} {}
+
+    private:
+    SampleElement * elements_; 
+    size_t elementCount_;
+
+            template<bool is_const>
+            struct iterator_state {
+                typedef std::random_access_iterator_tag iterator_category;
+                typedef typename std::conditional<is_const, const SampleContainer, SampleContainer>::type        container_type;
+                typedef typename std::conditional<is_const, const SampleElement, SampleElement>::type            value_type;
+
+                // Unconnected states are at index -1, connected states stay in [0, elementCount_]
+                static constexpr bool compares_unconnected = true;
+
+                // The container is only accessed in `begin()` / `end()`: the iterators outlive the container object (borrowed range)
+                container_type * container_{nullptr};
+                value_type * elements_{nullptr};
+                ptrdiff_t current_{-1};
+
+                // Default Construction without container connection (ALL Iterators)
+                inline iterator_state() = default;
+
+                // Construction with connected container; (ALL Iterators)
+                inline iterator_state(container_type * container): container_(container), elements_(container->elements_) {}
+
+
+                // Copy Construction - defaulted to keep the state and therefore the iterator trivially copyable (ALL Iterators)
+                inline iterator_state(const iterator_state & source) = default;
+
+                // Copy Construction from the other variant - allows changeble to const and vice versa assignment (ALL Iterators)
+                inline iterator_state(const iterator_state<!is_const> & source): container_(source.container_), elements_(source.elements_), current_(source.current_) {}
+
+                // Start and End Positions (ALL Iterators)
+                inline void begin() {current_ = 0; }
+                inline void end() {current_ = static_cast<ptrdiff_t>(container_->elementCount_); }
+
+                // Availability and Equality (ALL Iterators)
+                inline bool is_connected() const { return container_ != nullptr; }
+                inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
+                inline bool is_equal(const iterator_state<false> & other) const { return current_ == other.current_; }
+
+
+                // Move Next (ALL Iterators)
+                inline void next() { ++current_; }
+
+
+                // Element Access (ALL Iterators)
+                template<typename T = value_type>
+                inline typename std::enable_if<! is_const, T>::type & get() {return elements_[current_]; }
+
+                template<typename T = value_type>
+                inline typename std::enable_if<is_const, T>::type & get() const {return elements_[current_]; }
+
+
+                // Move Previous (Bidirectional, Random Access Iterators)
+                inline void prev() { --current_; }
+
+                // Move to position (Random Access Iterators)
+                inline void move(std::ptrdiff_t offset) { current_ += offset; }
+
+                // Calculate Distance (Random Access Iterators)
+                inline std::ptrdiff_t distance(const iterator_state<true> & rhs) const { return current_ - rhs.current_; }
+                inline std::ptrdiff_t distance(const iterator_state<false> & rhs) const { return current_ - rhs.current_; }
+
+
+                // Element access at position (Random Access Iterators)
+                template<typename T = value_type>
+                inline typename std::enable_if<! is_const, T>::type & at(std::ptrdiff_t offset) {return elements_[current_ + offset]; }
+
+                template<typename T = std::ptrdiff_t>
+                inline value_type & at(typename std::enable_if<is_const, T>::type offset) const {return elements_[current_ + offset]; }
+            };
+
+    public:
+            SETUP_RANGE_ITERATORS(iterator_state);
+            SETUP_REVERSE_ITERATORS(iterator_state);
+};
+
+SETUP_BORROWED_VIEW(SampleContainer)
+
+#endif
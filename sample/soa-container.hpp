@@ -0,0 +1,153 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#ifndef _tmc_sample_soa_container_hpp_
+#define _tmc_sample_soa_container_hpp_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <tmc/foundation/custom-iterator-template-helper.hpp>
+
+// Element of the struct of arrays container - the `value_type` of its iterators
+struct SoAElement {
+    int64_t key;
+    double value;
+    double weight;
+};
+
+// Proxy reference into the columns of a `SoAContainer` - behaves like `SoAElement &`
+// Assignments write the referenced column entries, `swap()` exchanges them (`std::sort`, `std::iter_swap`)
+template<bool is_const>
+struct SoAReference {
+    typedef typename std::conditional<is_const, const int64_t, int64_t>::type key_type;
+    typedef typename std::conditional<is_const, const double, double>::type double_type;
+
+    key_type &key;
+    double_type &value;
+    double_type &weight;
+
+    inline SoAReference(key_type &key, double_type &value, double_type &weight): key(key), value(value), weight(weight) {}
+
+    // Copies refer to the same row, the assignments below write through
+    inline SoAReference(const SoAReference &) = default;
+
+    inline operator SoAElement() const { return SoAElement{key, value, weight}; }
+
+    inline const SoAReference & operator=(const SoAElement &element) const {
+        key = element.key;
+        value = element.value;
+        weight = element.weight;
+        return *this;
+    }
+
+    inline const SoAReference & operator=(const SoAReference &other) const {
+        key = other.key;
+        value = other.value;
+        weight = other.weight;
+        return *this;
+    }
+
+    friend inline void swap(SoAReference lhs, SoAReference rhs) {
+        SoAElement temporary = lhs;
+        lhs = rhs;
+        rhs = temporary;
+    }
+};
+
+// Container storing the element members in separate columns (struct of arrays)
+// Scans of one member touch only its column, the iterators return `SoAReference` proxies
+class SoAContainer{
+
+    public:
+    void push_back(const SoAElement &element) {
+        keys_.push_back(element.key);
+        values_.push_back(element.value);
+        weights_.push_back(element.weight);
+    }
+
+    void resize(std::size_t size) {
+        keys_.resize(size);
+        values_.resize(size);
+        weights_.resize(size);
+    }
+
+    std::size_t size() const { return keys_.size(); }
+
+    const std::vector<int64_t> & keys() const { return keys_; }
+    const std::vector<double> & values() const { return values_; }
+    const std::vector<double> & weights() const { return weights_; }
+
+    private:
+    std::vector<int64_t> keys_;
+    std::vector<double> values_;
+    std::vector<double> weights_;
+
+            template<bool is_const>
+            struct iterator_state {
+                typedef std::random_access_iterator_tag iterator_category;
+                typedef typename std::conditional<is_const, const SoAContainer, SoAContainer>::type        container_type;
+                typedef typename std::conditional<is_const, const SoAElement, SoAElement>::type            value_type;
+
+                // Proxy reference - `operator->()` returns an arrow proxy holding it
+                typedef SoAReference<is_const>                                                            reference;
+
+                // Unconnected states are at row -1, connected states stay in [0, size()]
+                static constexpr bool compares_unconnected = true;
+
+                container_type * container_{nullptr};
+                std::ptrdiff_t current_{-1};
+
+                // Default Construction without container connection (ALL Iterators)
+                inline iterator_state() = default;
+
+                // Construction with connected container; (ALL Iterators)
+                inline iterator_state(container_type * container): container_(container) {}
+
+                // Copy Construction - defaulted to keep the state trivially copyable (ALL Iterators)
+                inline iterator_state(const iterator_state & source) = default;
+
+                // Copy Construction from the other variant - allows changeble to const and vice versa assignment (ALL Iterators)
+                inline iterator_state(const iterator_state<!is_const> & source): container_(source.container_), current_(source.current_) {}
+
+                // Start and End Positions (ALL Iterators)
+                inline void begin() { current_ = 0; }
+                inline void end() { current_ = static_cast<std::ptrdiff_t>(container_->size()); }
+
+                // Availability and Equality (ALL Iterators)
+                inline bool is_connected() const { return container_ != nullptr; }
+
+                template<bool other_is_const>
+                inline bool is_equal(const iterator_state<other_is_const> & other) const { return current_ == other.current_; }
+
+                // Move Next (ALL Iterators)
+                inline void next() { ++current_; }
+
+                // Element Access (ALL Iterators)
+                inline reference get() const { return at(0); }
+
+                // Move Previous (Bidirectional, Random Access Iterators)
+                inline void prev() { --current_; }
+
+                // Move to position (Random Access Iterators)
+                inline void move(std::ptrdiff_t offset) { current_ += offset; }
+
+                // Calculate Distance (Random Access Iterators)
+                template<bool other_is_const>
+                inline std::ptrdiff_t distance(const iterator_state<other_is_const> & rhs) const { return current_ - rhs.current_; }
+
+                // Element access at position (Random Access Iterators)
+                inline reference at(std::ptrdiff_t offset) const {
+                    const std::size_t index = static_cast<std::size_t>(current_ + offset);
+                    return reference{container_->keys_[index], container_->values_[index], container_->weights_[index]};
+                }
+            };
+
+    public:
+            SETUP_RANGE_ITERATORS(iterator_state);
+            SETUP_REVERSE_ITERATORS(iterator_state);
+};
+
+#endif
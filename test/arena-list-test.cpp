@@ -0,0 +1,179 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <iterator>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include "arena-list.hpp"
+
+using namespace std;
+using namespace testing;
+
+static_assert(std::is_same<std::iterator_traits<ArenaList<int>::iterator>::iterator_category, std::bidirectional_iterator_tag>::value, "The arena list has bidirectional iterators");
+static_assert(std::is_trivially_copyable<ArenaList<int>::iterator>::value, "The node iterator must be trivially copyable");
+static_assert(!std::is_same<ArenaList<int>::reverse_iterator, std::reverse_iterator<ArenaList<int>::iterator>>::value, "The arena list has native reverse iterators");
+
+TEST(ArenaList, TestPushAndIterate) {
+    ArenaList<int> list{2, 3};
+    list.push_front(1);
+    list.push_back(4);
+
+    EXPECT_EQ(list.size(), 4u);
+    EXPECT_THAT(std::vector<int>(list.begin(), list.end()), ElementsAre(1, 2, 3, 4));
+    EXPECT_THAT(std::vector<int>(list.rbegin(), list.rend()), ElementsAre(4, 3, 2, 1));
+    EXPECT_EQ(*--list.end(), 4);
+    EXPECT_EQ(std::distance(list.cbegin(), list.cend()), 4);
+
+    ArenaList<int> empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.begin(), empty.end());
+}
+
+TEST(ArenaList, TestInsertAndErase) {
+    ArenaList<int> list{1, 2, 4, 5};
+
+    auto it = list.insert(std::find(list.begin(), list.end(), 4), 3);
+    EXPECT_EQ(*it, 3);
+    it = list.erase(std::find(list.begin(), list.end(), 1));
+    EXPECT_EQ(*it, 2);
+    it = list.erase(std::find(list.begin(), list.end(), 5));
+    EXPECT_EQ(it, list.end());
+    list.insert(list.end(), 6);
+
+    EXPECT_EQ(list.size(), 4u);
+    EXPECT_THAT(std::vector<int>(list.begin(), list.end()), ElementsAre(2, 3, 4, 6));
+    EXPECT_THAT(std::vector<int>(list.rbegin(), list.rend()), ElementsAre(6, 4, 3, 2));
+}
+
+TEST(ArenaList, TestCompactLinksNodesInTraversalOrder) {
+    ArenaList<int> list;
+    for (int value = 0; value < 100; ++value) {
+        // Alternating front and back: allocation order differs from the traversal order
+        value % 2 == 0 ? list.push_back(value) : list.push_front(value);
+    }
+    const std::vector<int> expected(list.begin(), list.end());
+
+    list.compact();
+
+    EXPECT_THAT(std::vector<int>(list.begin(), list.end()), ElementsAreArray(expected));
+    EXPECT_THAT(std::vector<int>(list.rbegin(), list.rend()), ElementsAreArray(expected.rbegin(), expected.rend()));
+
+    std::vector<const int *> addresses;
+    for (const int &value: list) {
+        addresses.push_back(&value);
+    }
+    EXPECT_TRUE(std::is_sorted(addresses.begin(), addresses.end()));
+    const auto stride = reinterpret_cast<const char *>(addresses[1]) - reinterpret_cast<const char *>(addresses[0]);
+    EXPECT_EQ(reinterpret_cast<const char *>(addresses.back()) - reinterpret_cast<const char *>(addresses.front()), stride * 99);
+
+    // The list stays usable after the compaction
+    list.push_back(100);
+    list.erase(list.begin());
+    EXPECT_EQ(list.size(), 100u);
+    EXPECT_EQ(*--list.end(), 100);
+
+    ArenaList<int> empty;
+    empty.compact();
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.begin(), empty.end());
+}
+
+// Element with a throwing move constructor: `compact()` copies it, the copy throws after `copiesLeft` copies
+struct ThrowingCopyElement {
+    static int copiesLeft;
+    static int instances;
+
+    int value;
+
+    ThrowingCopyElement(int value): value(value) { ++instances; }
+    ThrowingCopyElement(const ThrowingCopyElement &other): value(other.value) {
+        if (copiesLeft-- == 0) {
+            throw std::runtime_error("copy failed");
+        }
+        ++instances;
+    }
+    ThrowingCopyElement(ThrowingCopyElement &&other) noexcept(false): value(other.value) { ++instances; }
+    ~ThrowingCopyElement() { --instances; }
+};
+
+int ThrowingCopyElement::copiesLeft = 0;
+int ThrowingCopyElement::instances = 0;
+
+TEST(ArenaList, TestThrowingCompactLeavesTheListUnchanged) {
+    {
+        ArenaList<ThrowingCopyElement> list;
+        ThrowingCopyElement::copiesLeft = 100;
+        for (int value = 0; value < 5; ++value) {
+            list.push_back(ThrowingCopyElement(value));
+        }
+        EXPECT_EQ(ThrowingCopyElement::instances, 5);
+
+        ThrowingCopyElement::copiesLeft = 2;
+        EXPECT_THROW(list.compact(), std::runtime_error);
+        EXPECT_EQ(ThrowingCopyElement::instances, 5);
+        std::vector<int> values;
+        for (const auto &element: list) {
+            values.push_back(element.value);
+        }
+        EXPECT_THAT(values, ElementsAre(0, 1, 2, 3, 4));
+
+        ThrowingCopyElement::copiesLeft = 100;
+        list.compact();
+        EXPECT_EQ(ThrowingCopyElement::instances, 5);
+        EXPECT_EQ((--list.end())->value, 4);
+    }
+    EXPECT_EQ(ThrowingCopyElement::instances, 0);
+}
+
+TEST(ArenaList, TestOtherMemoryResource) {
+    ArenaList<std::vector<int>> list({{1}, {2, 3}}, std::pmr::new_delete_resource());
+    list.erase(list.begin());
+    list.push_back({4, 5, 6});
+
+    EXPECT_THAT(std::vector<std::vector<int>>(list.begin(), list.end()), ElementsAre(ElementsAre(2, 3), ElementsAre(4, 5, 6)));
+    list.compact();
+    EXPECT_THAT(std::vector<std::vector<int>>(list.cbegin(), list.cend()), ElementsAre(ElementsAre(2, 3), ElementsAre(4, 5, 6)));
+}
+
+TEST(ArenaList, TestNativeReverseIterators) {
+    ArenaList<int> list{1, 2, 3};
+    const ArenaList<int> &constList = list;
+
+    ArenaList<int>::const_reverse_iterator last = list.rend();
+    EXPECT_EQ(*--last, 1);
+    EXPECT_EQ(*++constList.rbegin(), 2);
+    EXPECT_EQ(std::distance(constList.rbegin(), constList.rend()), 3);
+
+    for (auto i = list.rbegin(); i != list.rend(); ++i) {
+        *i *= 10;
+    }
+    EXPECT_THAT(std::vector<int>(list.begin(), list.end()), ElementsAre(10, 20, 30));
+
+    ArenaList<int> empty;
+    EXPECT_EQ(empty.rbegin(), empty.rend());
+}
+
+TEST(ArenaList, TestReleasingNodesAdvancesTheGeneration) {
+    ArenaList<int> list{1, 2, 3};
+    const auto generation = [&list]() { return tmc::foundation::custom_iterator_access::state(list.cbegin()).generation(); };
+    const std::size_t initial = generation();
+
+    list.push_back(4);
+    list.insert(list.begin(), 0);
+    EXPECT_EQ(generation(), initial);
+
+    // The result of `erase()` records the new generation: dereferenceable in checked builds
+    auto it = list.erase(list.begin());
+    EXPECT_EQ(generation(), initial + 1);
+    EXPECT_EQ(*it, 1);
+    list.compact();
+    EXPECT_EQ(generation(), initial + 2);
+    list.clear();
+    EXPECT_EQ(generation(), initial + 3);
+}
@@ -0,0 +1,206 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/bit-packed-vector.hpp>
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+static_assert(bit_packed_vector<1>::elements_per_word == 64 && bit_packed_vector<3>::elements_per_word == 21 && bit_packed_vector<12>::elements_per_word == 5, "A lane must not straddle two words");
+static_assert(std::is_same<bit_packed_vector<8>::value_type, std::uint8_t>::value && std::is_same<bit_packed_vector<12>::value_type, std::uint16_t>::value, "The value type must be the smallest unsigned type holding the bits");
+static_assert(std::is_same<bit_packed_vector<12>::iterator::iterator_category, std::random_access_iterator_tag>::value, "Bit packed vectors must have random access iterators");
+static_assert(std::is_same<bit_packed_vector<12>::iterator::reference, bit_packed_reference<12, false>>::value, "Bit packed iterators must return proxies");
+static_assert(packed_iterator_traits<bit_packed_vector<12>::iterator>::is_packed && packed_iterator_traits<bit_packed_vector<12>::const_iterator>::is_packed, "Bit packed iterators must implement the packed protocol");
+static_assert(! packed_iterator_traits<bit_packed_vector<12>::reverse_iterator>::is_packed && ! packed_iterator_traits<std::vector<std::uint16_t>::iterator>::is_packed, "Other iterators must not be packed");
+
+#if __cplusplus >= 202002L
+static_assert(std::random_access_iterator<bit_packed_vector<12>::iterator> && std::random_access_iterator<bit_packed_vector<12>::const_iterator>, "Bit packed iterators must be random access iterators");
+#endif
+
+// Deterministic values covering all bits of the lanes
+template<unsigned Bits>
+static std::vector<std::uint32_t> MakeValues(std::size_t count) {
+    std::vector<std::uint32_t> values(count);
+    for (std::size_t index = 0; index < count; ++index) {
+        values[index] = static_cast<std::uint32_t>((index * 2654435761u) >> 7) & static_cast<std::uint32_t>(detail::packed_layout<Bits>::mask);
+    }
+    return values;
+}
+
+template<unsigned Bits>
+static bit_packed_vector<Bits> MakePacked(const std::vector<std::uint32_t> &values) {
+    bit_packed_vector<Bits> packed;
+    for (std::uint32_t value: values) {
+        packed.push_back(static_cast<typename bit_packed_vector<Bits>::value_type>(value));
+    }
+    return packed;
+}
+
+template<unsigned Bits>
+static std::vector<std::uint32_t> Unpack(const bit_packed_vector<Bits> &packed) {
+    std::vector<std::uint32_t> values;
+    for (std::uint32_t value: packed) {
+        values.push_back(value);
+    }
+    return values;
+}
+
+// Ranges starting and ending in the middle of words, on word boundaries and within one word
+static const std::size_t RangeBounds[][2] = {{0, 0}, {0, 200}, {1, 2}, {3, 4}, {5, 150}, {21, 189}, {64, 128}, {63, 65}, {7, 11}, {199, 200}};
+
+template<unsigned Bits>
+static void CheckWordAlgorithms() {
+    SCOPED_TRACE(Bits);
+    const std::vector<std::uint32_t> values = MakeValues<Bits>(200);
+    bit_packed_vector<Bits> packed = MakePacked<Bits>(values);
+    const bit_packed_vector<Bits> &constPacked = packed;
+
+    for (const auto &bounds: RangeBounds) {
+        SCOPED_TRACE(bounds[0]);
+        SCOPED_TRACE(bounds[1]);
+        const auto first = constPacked.begin() + static_cast<std::ptrdiff_t>(bounds[0]);
+        const auto last = constPacked.begin() + static_cast<std::ptrdiff_t>(bounds[1]);
+        const auto valuesFirst = values.begin() + static_cast<std::ptrdiff_t>(bounds[0]);
+        const auto valuesLast = values.begin() + static_cast<std::ptrdiff_t>(bounds[1]);
+
+        for (std::uint32_t value: {values[3], values[150], 0u, static_cast<std::uint32_t>(detail::packed_layout<Bits>::mask)}) {
+            EXPECT_EQ(tmc::foundation::count(first, last, value), std::count(valuesFirst, valuesLast, value));
+        }
+        EXPECT_EQ(tmc::foundation::accumulate(first, last, std::uint64_t{0}), std::accumulate(valuesFirst, valuesLast, std::uint64_t{0}));
+        // Order dependent fold, unsigned wrap around is defined
+        EXPECT_EQ(tmc::foundation::accumulate(first, last, std::uint64_t{0}, [](std::uint64_t sum, std::uint32_t value) { return sum * 3 + value; }),
+                  std::accumulate(valuesFirst, valuesLast, std::uint64_t{0}, [](std::uint64_t sum, std::uint32_t value) { return sum * 3 + value; }));
+
+        std::vector<std::uint32_t> unpacked(bounds[1] - bounds[0]);
+        EXPECT_TRUE(tmc::foundation::copy(first, last, unpacked.begin()) == unpacked.end());
+        EXPECT_THAT(unpacked, ElementsAreArray(valuesFirst, valuesLast));
+
+        // Copies into packed vectors at the same lane (word copies) and at an other lane (decoded)
+        for (std::size_t target: {bounds[0], bounds[0] + 1}) {
+            bit_packed_vector<Bits> copied(201);
+            const auto result = tmc::foundation::copy(first, last, copied.begin() + static_cast<std::ptrdiff_t>(target));
+            EXPECT_TRUE(result == copied.begin() + static_cast<std::ptrdiff_t>(target + bounds[1] - bounds[0]));
+            std::vector<std::uint32_t> expected(201);
+            std::copy(valuesFirst, valuesLast, expected.begin() + static_cast<std::ptrdiff_t>(target));
+            EXPECT_THAT(Unpack(copied), ElementsAreArray(expected));
+        }
+
+        bit_packed_vector<Bits> encoded(200);
+        EXPECT_TRUE(tmc::foundation::copy(valuesFirst, valuesLast, encoded.begin() + static_cast<std::ptrdiff_t>(bounds[0])) == encoded.begin() + static_cast<std::ptrdiff_t>(bounds[1]));
+        std::vector<std::uint32_t> expected(200);
+        std::copy(valuesFirst, valuesLast, expected.begin() + static_cast<std::ptrdiff_t>(bounds[0]));
+        EXPECT_THAT(Unpack(encoded), ElementsAreArray(expected));
+
+        bit_packed_vector<Bits> filled = packed;
+        std::vector<std::uint32_t> expectedFill = values;
+        const std::uint32_t fillValue = values[7] ^ 1u;
+        tmc::foundation::fill(filled.begin() + static_cast<std::ptrdiff_t>(bounds[0]), filled.begin() + static_cast<std::ptrdiff_t>(bounds[1]), fillValue);
+        std::fill(expectedFill.begin() + static_cast<std::ptrdiff_t>(bounds[0]), expectedFill.begin() + static_cast<std::ptrdiff_t>(bounds[1]), fillValue);
+        EXPECT_THAT(Unpack(filled), ElementsAreArray(expectedFill));
+    }
+}
+
+TEST(BitPackedVector, TestElementAccess) {
+    bit_packed_vector<5> packed{1, 2, 3, 31, 0, 17, 8, 9, 10, 11, 12, 13, 14};
+
+    EXPECT_EQ(packed.size(), 13u);
+    EXPECT_EQ(packed.size_bytes(), 16u);
+    EXPECT_EQ(packed[3], 31);
+    EXPECT_EQ(packed.begin()[12], 14);
+    EXPECT_EQ(*(packed.end() - 8), 17);
+    EXPECT_EQ(packed.end() - packed.begin(), 13);
+
+    packed[0] = 33;
+    *(packed.begin() + 12) = 4;
+    packed.begin()[11] = packed[1];
+    EXPECT_THAT(Unpack(packed), ElementsAre(1, 2, 3, 31, 0, 17, 8, 9, 10, 11, 12, 2, 4));
+    EXPECT_THAT(std::vector<std::uint32_t>(packed.rbegin(), packed.rbegin() + 3), ElementsAre(4, 2, 12));
+}
+
+TEST(BitPackedVector, TestStdAlgorithmsOnProxies) {
+    bit_packed_vector<7> packed{90, 3, 127, 45, 3, 0, 64, 12, 100, 7, 3};
+
+    std::sort(packed.begin(), packed.end());
+    EXPECT_THAT(Unpack(packed), ElementsAre(0, 3, 3, 3, 7, 12, 45, 64, 90, 100, 127));
+    EXPECT_TRUE(std::binary_search(packed.cbegin(), packed.cend(), 64));
+    EXPECT_EQ(std::count(packed.cbegin(), packed.cend(), 3), 3);
+
+    std::reverse(packed.begin(), packed.end());
+    EXPECT_THAT(Unpack(packed), ElementsAre(127, 100, 90, 64, 45, 12, 7, 3, 3, 3, 0));
+}
+
+TEST(BitPackedVector, TestResize) {
+    bit_packed_vector<12> packed(7, 4095);
+    EXPECT_EQ(packed.size_bytes(), 16u);
+
+    packed.resize(3);
+    EXPECT_EQ(packed.words()[0], 0xfffull | 0xfffull << 12 | 0xfffull << 24);
+    EXPECT_EQ(packed.size_bytes(), 8u);
+
+    packed.resize(6, 5);
+    packed.push_back(4096 + 6);
+    EXPECT_THAT(Unpack(packed), ElementsAre(4095, 4095, 4095, 5, 5, 5, 6));
+    EXPECT_EQ(tmc::foundation::count(packed.begin(), packed.end(), 5), 3);
+    EXPECT_EQ(tmc::foundation::count(packed.begin(), packed.end(), -1), 0);
+    EXPECT_EQ(tmc::foundation::count(packed.begin(), packed.end(), 4095 + 6), 0);
+    EXPECT_EQ(tmc::foundation::count(packed.begin(), packed.end(), -1), std::count(packed.begin(), packed.end(), -1));
+
+    packed.clear();
+    EXPECT_TRUE(packed.empty());
+    EXPECT_TRUE(packed.begin() == packed.end());
+}
+
+TEST(BitPackedVector, TestWordAlgorithms) {
+    CheckWordAlgorithms<1>();
+    CheckWordAlgorithms<2>();
+    CheckWordAlgorithms<3>();
+    CheckWordAlgorithms<4>();
+    CheckWordAlgorithms<5>();
+    CheckWordAlgorithms<7>();
+    CheckWordAlgorithms<8>();
+    CheckWordAlgorithms<11>();
+    CheckWordAlgorithms<12>();
+    CheckWordAlgorithms<16>();
+    CheckWordAlgorithms<32>();
+}
+
+TEST(BitPackedVector, TestCountConvertsLikeStdCount) {
+    bit_packed_vector<32> packed(3, 0xffffffffu);
+    packed.push_back(1);
+
+    // -1 converts to the unsigned 32 bit element type
+    EXPECT_EQ(std::count(packed.begin(), packed.end(), -1), 3);
+    EXPECT_EQ(tmc::foundation::count(packed.begin(), packed.end(), -1), 3);
+    EXPECT_EQ(tmc::foundation::count(packed.begin(), packed.end(), std::int64_t{-1}), std::count(packed.begin(), packed.end(), std::int64_t{-1}));
+    EXPECT_EQ(tmc::foundation::count(packed.begin(), packed.end(), std::int64_t{0xffffffff}), 3);
+    EXPECT_EQ(tmc::foundation::count(packed.begin(), packed.end(), true), 1);
+}
+
+TEST(BitPackedVector, TestSizeChangesAdvanceTheGeneration) {
+    bit_packed_vector<12> packed(3, 7);
+    const auto generation = [&packed]() { return custom_iterator_access::state(packed.cbegin()).generation(); };
+    const std::size_t initial = generation();
+
+    packed[1] = 9;
+    std::fill(packed.begin(), packed.end(), 1);
+    EXPECT_EQ(generation(), initial);
+
+    packed.push_back(2);
+    EXPECT_EQ(generation(), initial + 1);
+    packed.resize(10);
+    EXPECT_EQ(generation(), initial + 2);
+    packed.clear();
+    EXPECT_EQ(generation(), initial + 3);
+}
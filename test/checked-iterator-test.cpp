@@ -0,0 +1,207 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+#include <gtest/gtest.h>
+#include <tmc/foundation/custom-iterator-template.hpp>
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+// Reports failed checks as exceptions instead of aborting
+struct ThrowingCheckPolicy {
+    static constexpr bool enabled = true;
+
+    [[noreturn]] static void failed(const char * message) { throw std::logic_error(message); }
+};
+
+// Vector backed container counting its modifications, the state implements both check hooks
+class GenerationContainer {
+    public:
+    GenerationContainer(std::initializer_list<int> values): elements_(values) {}
+
+    void push_back(int value) {
+        elements_.push_back(value);
+        ++generation_;
+    }
+
+    template<bool is_const>
+    struct iterator_state {
+#if __cplusplus >= 202002L
+        typedef std::contiguous_iterator_tag iterator_category;
+#else
+        typedef std::random_access_iterator_tag iterator_category;
+#endif
+        typedef typename std::conditional<is_const, const GenerationContainer, GenerationContainer>::type container_type;
+        typedef typename std::conditional<is_const, const int, int>::type value_type;
+
+        container_type * container_{nullptr};
+        std::ptrdiff_t current_{0};
+
+        inline iterator_state() = default;
+        inline iterator_state(container_type * container): container_(container) { ++container_->connections_; }
+
+        template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+        inline iterator_state(const iterator_state<other_is_const> & source): container_(source.container_), current_(source.current_) {}
+
+        inline void begin() { current_ = 0; }
+        inline void end() { current_ = static_cast<std::ptrdiff_t>(container_->elements_.size()); }
+
+        inline bool is_connected() const { return container_ != nullptr; }
+        inline bool is_end() const { return current_ == static_cast<std::ptrdiff_t>(container_->elements_.size()); }
+
+        template<bool other_is_const>
+        inline bool is_equal(const iterator_state<other_is_const> & other) const { return current_ == other.current_; }
+
+        inline void next() { ++current_; }
+        inline value_type & get() const { return container_->elements_[static_cast<std::size_t>(current_)]; }
+        inline void prev() { --current_; }
+        inline void move(std::ptrdiff_t offset) { current_ += offset; }
+
+        template<bool other_is_const>
+        inline std::ptrdiff_t distance(const iterator_state<other_is_const> & rhs) const { return current_ - rhs.current_; }
+
+        inline value_type & at(std::ptrdiff_t offset) const { return container_->elements_[static_cast<std::size_t>(current_ + offset)]; }
+        inline value_type * address() const { return container_->elements_.data() + current_; }
+
+        // Check Hooks (Checked Iterators)
+        inline std::size_t generation() const { return container_->generation_; }
+        inline container_type * container() const { return container_; }
+        inline std::ptrdiff_t index() const { return current_; }
+        inline std::ptrdiff_t size() const { return static_cast<std::ptrdiff_t>(container_->elements_.size()); }
+    };
+
+    typedef custom_iterator_template<iterator_state, false, ThrowingCheckPolicy> iterator;
+    typedef custom_iterator_template<iterator_state, true, ThrowingCheckPolicy> const_iterator;
+    typedef custom_iterator_template<iterator_state, false, unchecked_iterator_policy> unchecked_iterator;
+
+    iterator begin() { return iterator::begin(this); }
+    iterator end() { return iterator::end(this); }
+    const_iterator cbegin() const { return const_iterator::begin(this); }
+    const_iterator cend() const { return const_iterator::end(this); }
+
+    std::size_t connections() const { return connections_; }
+
+    private:
+    std::vector<int> elements_;
+    std::size_t generation_{0};
+    // Connected state constructions
+    mutable std::size_t connections_{0};
+};
+
+#if TMC_CUSTOM_ITERATOR_CHECKED
+static_assert(std::is_same<default_iterator_policy, checked_iterator_policy>::value, "Builds without NDEBUG use checked iterators");
+#else
+static_assert(std::is_same<default_iterator_policy, unchecked_iterator_policy>::value, "Release builds use unchecked iterators");
+#endif
+
+static_assert(sizeof(GenerationContainer::unchecked_iterator) == sizeof(GenerationContainer::iterator_state<false>), "Unchecked iterators are the state only");
+static_assert(sizeof(GenerationContainer::iterator) > sizeof(GenerationContainer::iterator_state<false>), "Checked iterators record the generation");
+static_assert(std::is_trivially_copyable<GenerationContainer::iterator>::value, "Checked iterators of trivial states stay trivially copyable");
+
+TEST(CheckedIterator, TestValidUse) {
+    GenerationContainer container{1, 2, 3, 4};
+
+    GenerationContainer::const_iterator it = container.begin() + 1;
+    EXPECT_EQ(*it, 2);
+    EXPECT_EQ(it[2], 4);
+    EXPECT_EQ(container.end() - it, 3);
+    EXPECT_EQ(it + 3, container.cend());
+    EXPECT_EQ(*(container.end() - 4), 1);
+    EXPECT_TRUE(GenerationContainer::iterator() == GenerationContainer::iterator());
+    EXPECT_FALSE(GenerationContainer::iterator() == container.begin());
+}
+
+TEST(CheckedIterator, TestDereferenceOfInvalidIterators) {
+    GenerationContainer container{1, 2, 3};
+
+    EXPECT_THROW(*GenerationContainer::iterator(), std::logic_error);
+    EXPECT_THROW(*container.end(), std::logic_error);
+    EXPECT_THROW(static_cast<void>(container.cend()[-4]), std::logic_error);
+    EXPECT_THROW(static_cast<void>(container.begin()[3]), std::logic_error);
+
+    auto it = container.begin();
+    container.push_back(4);
+    EXPECT_THROW(*it, std::logic_error);
+    EXPECT_EQ(*container.begin(), 1);
+}
+
+TEST(CheckedIterator, TestDereferenceConstructsNoState) {
+    GenerationContainer container{1, 2, 3};
+
+    const auto it = container.begin() + 1;
+    const std::size_t connections = container.connections();
+    EXPECT_EQ(*it, 2);
+    EXPECT_THROW(*container.cend(), std::logic_error);
+    EXPECT_EQ(container.connections(), connections + 1);
+}
+
+TEST(CheckedIterator, TestMovesConstructNoState) {
+    GenerationContainer container{1, 2, 3};
+
+    auto it = container.begin();
+    const std::size_t connections = container.connections();
+    it += 1;
+    EXPECT_EQ(it[1], 3);
+    EXPECT_EQ(*(it - 1), 1);
+    EXPECT_THROW(static_cast<void>(it[2]), std::logic_error);
+    EXPECT_EQ(container.connections(), connections);
+}
+
+#if __cplusplus >= 202002L
+static_assert(std::contiguous_iterator<GenerationContainer::iterator>, "Checked iterators of contiguous states are contiguous iterators");
+
+TEST(CheckedIterator, TestEndAddressOfContiguousIterators) {
+    GenerationContainer container{1, 2, 3};
+
+    // `std::to_address()` uses `operator->()`, the end address is no dereference
+    EXPECT_EQ(std::to_address(container.end()), std::to_address(container.begin()) + 3);
+    const std::span<const int> elements(container.cbegin(), container.cend());
+    EXPECT_EQ(elements.size(), 3u);
+    EXPECT_EQ(elements[2], 3);
+    EXPECT_THROW(*container.end(), std::logic_error);
+}
+#endif
+
+TEST(CheckedIterator, TestComparisonOfDifferentContainers) {
+    GenerationContainer container{1, 2, 3};
+    GenerationContainer otherContainer{1, 2, 3};
+
+    EXPECT_THROW(static_cast<void>(container.begin() == otherContainer.begin()), std::logic_error);
+    EXPECT_THROW(static_cast<void>(container.cend() != otherContainer.begin()), std::logic_error);
+    EXPECT_THROW(static_cast<void>(container.end() - otherContainer.begin()), std::logic_error);
+    EXPECT_THROW(static_cast<void>(container.begin() < otherContainer.cbegin()), std::logic_error);
+}
+
+TEST(CheckedIterator, TestMoveOutOfRange) {
+    GenerationContainer container{1, 2, 3};
+
+    auto it = container.begin();
+    EXPECT_THROW(it -= 1, std::logic_error);
+    EXPECT_THROW(it += 4, std::logic_error);
+    EXPECT_THROW(static_cast<void>(container.end() + 1), std::logic_error);
+    EXPECT_NO_THROW(it += 3);
+    EXPECT_EQ(it, container.end());
+    EXPECT_THROW(static_cast<void>(GenerationContainer::iterator() + 1), std::logic_error);
+}
+
+TEST(CheckedIterator, TestUncheckedPolicy) {
+    GenerationContainer container{1, 2, 3};
+
+    auto first = GenerationContainer::unchecked_iterator::begin(&container);
+    const auto last = GenerationContainer::unchecked_iterator::end(&container);
+    container.push_back(4);
+
+    // No checks: the invalidated iterator is used as is
+    EXPECT_EQ(last - first, 3);
+    EXPECT_EQ(first[3], 4);
+}
@@ -0,0 +1,36 @@
+# Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+# Licensed under MIT 
+
+# Release builds (`NDEBUG`) compile all iterator checks away: loops over states with the `generation()`, `container()`, `index()` and `size()`
+# check hooks compile to the same instructions as loops over the same states without them.
+# Checked builds (`TMC_CUSTOM_ITERATOR_CHECKED=1`) add the checks.
+include(${CMAKE_CURRENT_LIST_DIR}/codegen-helpers.cmake)
+
+compile_to_assembly(releaseAssembly ${CMAKE_CURRENT_LIST_DIR}/checked-codegen.cpp -DNDEBUG)
+compile_to_assembly(checkedAssembly ${CMAKE_CURRENT_LIST_DIR}/checked-codegen.cpp -DTMC_CUSTOM_ITERATOR_CHECKED=1)
+
+foreach(loop sum indexed strided)
+    function_body(plainLoop "${releaseAssembly}" codegen_plain_${loop}_loop)
+    function_body(hookedLoop "${releaseAssembly}" codegen_hooked_${loop}_loop)
+
+    # Jump targets are local labels, numbered per function
+    string(REGEX REPLACE "\\.L[0-9]+" ".L" plainLoop "${plainLoop}")
+    string(REGEX REPLACE "\\.L[0-9]+" ".L" hookedLoop "${hookedLoop}")
+    string(REPLACE "codegen_plain_${loop}_loop" "" plainLoop "${plainLoop}")
+    string(REPLACE "codegen_hooked_${loop}_loop" "" hookedLoop "${hookedLoop}")
+
+    if(NOT plainLoop STREQUAL hookedLoop)
+        message(FATAL_ERROR "Release ${loop} loop with check hooks differs from the loop without:\n${hookedLoop}\n--- without check hooks:\n${plainLoop}")
+    endif()
+
+    function_body(checkedPlainLoop "${checkedAssembly}" codegen_plain_${loop}_loop)
+    function_body(checkedHookedLoop "${checkedAssembly}" codegen_hooked_${loop}_loop)
+    count_compares(checkedPlainCompares "${checkedPlainLoop}")
+    count_compares(checkedHookedCompares "${checkedHookedLoop}")
+
+    message(STATUS "${loop} loop - release: identical, checked compares without / with check hooks: ${checkedPlainCompares} / ${checkedHookedCompares}")
+
+    if(NOT checkedHookedCompares GREATER checkedPlainCompares)
+        message(FATAL_ERROR "Checked ${loop} loop with check hooks is expected to use more compares than the loop without:\n${checkedHookedLoop}")
+    endif()
+endforeach()
@@ -0,0 +1,43 @@
+# Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+# Licensed under MIT 
+
+# Release builds (`NDEBUG`) of pointer backed states declaring `collapses_to_pointer` compile to the same instructions as
+# raw pointer loops, at -O1 too: the iterator is passed as a pointer and no forwarding layer remains
+include(${CMAKE_CURRENT_LIST_DIR}/codegen-helpers.cmake)
+
+# Jump targets are local labels numbered per function, the register operands of compares are ordered
+function(normalize_loop OUTPUT BODY)
+    string(REGEX REPLACE "\\.L[0-9]+" ".L" BODY "${BODY}")
+    string(REGEX REPLACE "codegen_[a-z]+_[a-z]+_loop" "" BODY "${BODY}")
+    string(REPLACE ";" "," BODY "${BODY}")
+    string(REPLACE "\n" ";" lines "${BODY}")
+    set(normalized "")
+    foreach(line IN LISTS lines)
+        if(line MATCHES "^\t(cmp[a-z]*)\t(%[a-z0-9]+), (%[a-z0-9]+)$")
+            set(operands ${CMAKE_MATCH_2} ${CMAKE_MATCH_3})
+            list(SORT operands)
+            list(JOIN operands ", " operands)
+            set(line "\t${CMAKE_MATCH_1}\t${operands}")
+        endif()
+        string(APPEND normalized "${line}\n")
+    endforeach()
+    set(${OUTPUT} "${normalized}" PARENT_SCOPE)
+endfunction()
+
+foreach(optimization -O1 -O2)
+    compile_to_assembly(assembly ${CMAKE_CURRENT_LIST_DIR}/collapse-codegen.cpp -DNDEBUG ${optimization})
+
+    foreach(loop sum scale find cursor)
+        function_body(pointerLoop "${assembly}" codegen_pointer_${loop}_loop)
+        function_body(collapsedLoop "${assembly}" codegen_collapsed_${loop}_loop)
+
+        normalize_loop(pointerLoop "${pointerLoop}")
+        normalize_loop(collapsedLoop "${collapsedLoop}")
+
+        if(NOT pointerLoop STREQUAL collapsedLoop)
+            message(FATAL_ERROR "${optimization} ${loop} loop of the collapsed iterator differs from the pointer loop:\n${collapsedLoop}\n--- pointer loop:\n${pointerLoop}")
+        endif()
+    endforeach()
+
+    message(STATUS "${optimization}: collapsed iterator loops identical to the pointer loops")
+endforeach()
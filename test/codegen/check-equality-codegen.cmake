@@ -0,0 +1,40 @@
+# Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+# Licensed under MIT 
+
+# Release builds (`NDEBUG`) compile `it != end` loops to the same compares as pointer loops: a single `cmp` per iteration,
+# no connection checks. Checked builds skip the connection checks for states declaring `compares_unconnected` only.
+include(${CMAKE_CURRENT_LIST_DIR}/codegen-helpers.cmake)
+
+compile_to_assembly(releaseAssembly ${CMAKE_CURRENT_LIST_DIR}/equality-codegen.cpp -DNDEBUG)
+
+function_body(pointerLoop "${releaseAssembly}" codegen_pointer_loop)
+function_body(releaseFastPathLoop "${releaseAssembly}" codegen_fast_path_loop)
+function_body(releaseConnectionCheckedLoop "${releaseAssembly}" codegen_connection_checked_loop)
+
+count_compares(pointerCompares "${pointerLoop}")
+count_compares(releaseFastPathCompares "${releaseFastPathLoop}")
+count_compares(releaseConnectionCheckedCompares "${releaseConnectionCheckedLoop}")
+
+message(STATUS "release compares - pointer loop: ${pointerCompares}, fast path loop: ${releaseFastPathCompares}, connection checked loop: ${releaseConnectionCheckedCompares}")
+
+if(NOT releaseFastPathCompares EQUAL pointerCompares)
+    message(FATAL_ERROR "Release fast path loop uses ${releaseFastPathCompares} compares, the pointer loop ${pointerCompares}:\n${releaseFastPathLoop}")
+endif()
+
+if(NOT releaseConnectionCheckedCompares EQUAL pointerCompares)
+    message(FATAL_ERROR "Release connection checked loop uses ${releaseConnectionCheckedCompares} compares, the pointer loop ${pointerCompares}:\n${releaseConnectionCheckedLoop}")
+endif()
+
+compile_to_assembly(checkedAssembly ${CMAKE_CURRENT_LIST_DIR}/equality-codegen.cpp -DTMC_CUSTOM_ITERATOR_CHECKED=1)
+
+function_body(checkedFastPathLoop "${checkedAssembly}" codegen_fast_path_loop)
+function_body(checkedConnectionCheckedLoop "${checkedAssembly}" codegen_connection_checked_loop)
+
+count_compares(checkedFastPathCompares "${checkedFastPathLoop}")
+count_compares(checkedConnectionCheckedCompares "${checkedConnectionCheckedLoop}")
+
+message(STATUS "checked compares - fast path loop: ${checkedFastPathCompares}, connection checked loop: ${checkedConnectionCheckedCompares}")
+
+if(NOT checkedConnectionCheckedCompares GREATER checkedFastPathCompares)
+    message(FATAL_ERROR "Checked connection checked loop is expected to use more compares than the fast path loop:\n${checkedConnectionCheckedLoop}")
+endif()
@@ -0,0 +1,94 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT 
+
+// Compiled to assembly by `check-checked-codegen.cmake` - not linked into any target
+// The same loops over a container without check hooks (plain) and with the `generation()`, `container()`, `index()` and `size()` hooks (hooked)
+
+#include <cstddef>
+#include <type_traits>
+#include <tmc/foundation/custom-iterator-template-helper.hpp>
+
+template<bool has_check_hooks>
+struct CodegenContainer {
+    const int * elements_;
+    std::size_t elementCount_;
+    std::size_t generation_;
+
+    template<bool is_const>
+    struct plain_state {
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef const CodegenContainer container_type;
+        typedef const int value_type;
+
+        container_type * container_{nullptr};
+        const int * current_{nullptr};
+
+        inline plain_state() = default;
+        inline plain_state(container_type * container): container_(container) {}
+
+        inline void begin() { current_ = container_->elements_; }
+        inline void end() { current_ = container_->elements_ + container_->elementCount_; }
+
+        inline bool is_connected() const { return container_ != nullptr; }
+        inline bool is_equal(const plain_state<true> & other) const { return current_ == other.current_; }
+
+        inline void next() { ++current_; }
+        inline value_type & get() const { return *current_; }
+        inline void prev() { --current_; }
+        inline void move(std::ptrdiff_t offset) { current_ += offset; }
+        inline std::ptrdiff_t distance(const plain_state<true> & rhs) const { return current_ - rhs.current_; }
+        inline value_type & at(std::ptrdiff_t offset) const { return current_[offset]; }
+    };
+
+    template<bool is_const>
+    struct hooked_state: plain_state<is_const> {
+        using plain_state<is_const>::plain_state;
+
+        inline std::size_t generation() const { return this->container_->generation_; }
+        inline const CodegenContainer * container() const { return this->container_; }
+        inline std::ptrdiff_t index() const { return this->current_ - this->container_->elements_; }
+        inline std::ptrdiff_t size() const { return static_cast<std::ptrdiff_t>(this->container_->elementCount_); }
+    };
+
+    template<bool is_const>
+    using iterator_state = typename std::conditional<has_check_hooks, hooked_state<is_const>, plain_state<is_const>>::type;
+
+    SETUP_CONST_ITERATOR(iterator_state);
+};
+
+typedef CodegenContainer<false>::const_iterator plain_iterator;
+typedef CodegenContainer<true>::const_iterator hooked_iterator;
+
+template<typename TIterator>
+static int SumLoop(TIterator first, TIterator last) {
+    int sum = 0;
+    for (; first != last; ++first) {
+        sum += *first;
+    }
+    return sum;
+}
+
+template<typename TIterator>
+static int IndexedLoop(TIterator first, std::ptrdiff_t count) {
+    int sum = 0;
+    for (std::ptrdiff_t index = 0; index < count; ++index) {
+        sum += first[index];
+    }
+    return sum;
+}
+
+template<typename TIterator>
+static int StridedLoop(TIterator first, TIterator last) {
+    int sum = 0;
+    for (; last - first > 1; first += 2) {
+        sum += *first;
+    }
+    return sum;
+}
+
+extern "C" int codegen_plain_sum_loop(plain_iterator first, plain_iterator last) { return SumLoop(first, last); }
+extern "C" int codegen_hooked_sum_loop(hooked_iterator first, hooked_iterator last) { return SumLoop(first, last); }
+extern "C" int codegen_plain_indexed_loop(plain_iterator first, std::ptrdiff_t count) { return IndexedLoop(first, count); }
+extern "C" int codegen_hooked_indexed_loop(hooked_iterator first, std::ptrdiff_t count) { return IndexedLoop(first, count); }
+extern "C" int codegen_plain_strided_loop(plain_iterator first, plain_iterator last) { return StridedLoop(first, last); }
+extern "C" int codegen_hooked_strided_loop(hooked_iterator first, hooked_iterator last) { return StridedLoop(first, last); }
@@ -0,0 +1,44 @@
+# Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+# Licensed under MIT 
+
+# Helpers for the codegen checks - GCC/Clang on x86-64 ELF targets
+
+# Compiles SOURCE to assembly into the variable named by OUTPUT, additional flags are passed after SOURCE
+function(compile_to_assembly OUTPUT SOURCE)
+    execute_process(
+        COMMAND ${COMPILER} -std=${STANDARD} -O2 -fno-tree-vectorize -fno-unroll-loops -fno-asynchronous-unwind-tables
+                -I${INCLUDE_DIR} ${ARGN} -S -o - ${SOURCE}
+        OUTPUT_VARIABLE assembly
+        ERROR_VARIABLE errors
+        RESULT_VARIABLE result)
+
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Compilation of ${SOURCE} failed:\n${errors}")
+    endif()
+
+    set(${OUTPUT} "${assembly}" PARENT_SCOPE)
+endfunction()
+
+# Extracts the instructions of FUNCTION (an `extern "C"` symbol) from ASSEMBLY into the variable named by OUTPUT
+function(function_body OUTPUT ASSEMBLY FUNCTION)
+    string(FIND "${ASSEMBLY}" "\n${FUNCTION}:\n" begin)
+    if(begin EQUAL -1)
+        message(FATAL_ERROR "Function ${FUNCTION} not found in assembly")
+    endif()
+
+    string(SUBSTRING "${ASSEMBLY}" ${begin} -1 body)
+    string(FIND "${body}" "\t.size\t${FUNCTION}," end)
+    string(SUBSTRING "${body}" 0 ${end} body)
+
+    # Local labels differ between functions, keep the instructions only
+    string(REGEX REPLACE "\n\\.?L[A-Za-z0-9_]*:" "" body "${body}")
+    string(REGEX REPLACE "\n\t\\.[^\n]*" "" body "${body}")
+    set(${OUTPUT} "${body}" PARENT_SCOPE)
+endfunction()
+
+# Counts the compare (`cmp*`, `test*`) instructions in BODY into the variable named by OUTPUT
+function(count_compares OUTPUT BODY)
+    string(REGEX MATCHALL "\n\t(cmp|test)[a-z]*\t" compares "${BODY}")
+    list(LENGTH compares count)
+    set(${OUTPUT} ${count} PARENT_SCOPE)
+endfunction()
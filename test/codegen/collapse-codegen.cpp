@@ -0,0 +1,101 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT 
+
+// Compiled to assembly by `check-collapse-codegen.cmake` - not linked into any target
+// The same loops over raw pointers and over unchecked iterators of a pointer backed state declaring `collapses_to_pointer`
+
+#include <cstddef>
+#include <type_traits>
+#include <tmc/foundation/custom-iterator-template-helper.hpp>
+
+struct CodegenContainer {
+    int * elements_;
+    std::size_t elementCount_;
+
+    template<bool is_const>
+    struct iterator_state {
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CodegenContainer, CodegenContainer>::type container_type;
+        typedef typename std::conditional<is_const, const int, int>::type value_type;
+
+        static constexpr bool compares_unconnected = true;
+        static constexpr bool collapses_to_pointer = true;
+
+        container_type * container_{nullptr};
+        value_type * current_{nullptr};
+
+        inline iterator_state() = default;
+        inline iterator_state(container_type * container): container_(container) {}
+
+        inline void begin() { current_ = container_->elements_; }
+        inline void end() { current_ = container_->elements_ + container_->elementCount_; }
+
+        inline bool is_connected() const { return container_ != nullptr; }
+
+        template<bool other_is_const>
+        inline bool is_equal(const iterator_state<other_is_const> & other) const { return current_ == other.current_; }
+
+        inline void next() { ++current_; }
+        inline value_type & get() const { return *current_; }
+        inline value_type * address() const { return current_; }
+        inline void prev() { --current_; }
+        inline void move(std::ptrdiff_t offset) { current_ += offset; }
+
+        template<bool other_is_const>
+        inline std::ptrdiff_t distance(const iterator_state<other_is_const> & rhs) const { return current_ - rhs.current_; }
+
+        inline value_type & at(std::ptrdiff_t offset) const { return current_[offset]; }
+    };
+
+    SETUP_RANGE_ITERATORS(iterator_state);
+};
+
+typedef CodegenContainer::iterator collapsed_iterator;
+
+static_assert(sizeof(collapsed_iterator) == sizeof(int *), "Release iterators of pointer backed states are element pointers");
+
+template<typename TIterator>
+static int SumLoop(TIterator first, TIterator last) {
+    int sum = 0;
+    for (; first != last; ++first) {
+        sum += *first;
+    }
+    return sum;
+}
+
+template<typename TIterator>
+static void ScaleLoop(TIterator first, std::ptrdiff_t count, int factor) {
+    for (std::ptrdiff_t index = 0; index < count; index += 2) {
+        first[index] *= factor;
+    }
+}
+
+template<typename TIterator>
+static std::ptrdiff_t ReverseFind(TIterator first, TIterator last, int value) {
+    while (last != first) {
+        --last;
+        if (*last == value) {
+            return last - first;
+        }
+    }
+    return -1;
+}
+
+// Array of cursors: element pointers and collapsed iterators have the same stride
+template<typename TIterator>
+static int CursorLoop(const TIterator * cursors, std::size_t count) {
+    int sum = 0;
+    for (std::size_t index = 0; index < count; ++index) {
+        sum += *cursors[index];
+    }
+    return sum;
+}
+
+extern "C" int codegen_pointer_sum_loop(int * first, int * last) { return SumLoop(first, last); }
+extern "C" int codegen_collapsed_sum_loop(collapsed_iterator first, collapsed_iterator last) { return SumLoop(first, last); }
+extern "C" void codegen_pointer_scale_loop(int * first, std::ptrdiff_t count, int factor) { ScaleLoop(first, count, factor); }
+extern "C" void codegen_collapsed_scale_loop(collapsed_iterator first, std::ptrdiff_t count, int factor) { ScaleLoop(first, count, factor); }
+extern "C" std::ptrdiff_t codegen_pointer_find_loop(int * first, int * last, int value) { return ReverseFind(first, last, value); }
+extern "C" std::ptrdiff_t codegen_collapsed_find_loop(collapsed_iterator first, collapsed_iterator last, int value) { return ReverseFind(first, last, value); }
+extern "C" int codegen_pointer_cursor_loop(int * const * cursors, std::size_t count) { return CursorLoop(cursors, count); }
+extern "C" int codegen_collapsed_cursor_loop(const collapsed_iterator * cursors, std::size_t count) { return CursorLoop(cursors, count); }
@@ -0,0 +1,68 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT 
+
+// Compiled to assembly by `check-equality-codegen.cmake` - not linked into any target
+// The loops take their iterators as parameters, so the connection state is unknown to the compiler
+
+#include <cstddef>
+#include <type_traits>
+#include <tmc/foundation/custom-iterator-template-helper.hpp>
+
+template<bool skip_connection_checks>
+struct CodegenContainer {
+    const int * elements_;
+    std::size_t elementCount_;
+
+    template<bool is_const>
+    struct iterator_state {
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef const CodegenContainer container_type;
+        typedef const int value_type;
+
+        static constexpr bool compares_unconnected = skip_connection_checks;
+
+        container_type * container_{nullptr};
+        const int * current_{nullptr};
+
+        inline iterator_state() = default;
+        inline iterator_state(container_type * container): container_(container) {}
+
+        inline void begin() { current_ = container_->elements_; }
+        inline void end() { current_ = container_->elements_ + container_->elementCount_; }
+
+        inline bool is_connected() const { return container_ != nullptr; }
+        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
+
+        inline void next() { ++current_; }
+        inline value_type & get() const { return *current_; }
+    };
+
+    SETUP_CONST_ITERATOR(iterator_state);
+};
+
+typedef CodegenContainer<true>::const_iterator fast_path_iterator;
+typedef CodegenContainer<false>::const_iterator connection_checked_iterator;
+
+extern "C" int codegen_pointer_loop(const int * first, const int * last) {
+    int sum = 0;
+    for (; first != last; ++first) {
+        sum += *first;
+    }
+    return sum;
+}
+
+extern "C" int codegen_fast_path_loop(fast_path_iterator first, fast_path_iterator last) {
+    int sum = 0;
+    for (; first != last; ++first) {
+        sum += *first;
+    }
+    return sum;
+}
+
+extern "C" int codegen_connection_checked_loop(connection_checked_iterator first, connection_checked_iterator last) {
+    int sum = 0;
+    for (; first != last; ++first) {
+        sum += *first;
+    }
+    return sum;
+}
@@ -0,0 +1,1029 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT 
+
+#ifndef _tmc_test_custom_container_skeletons_hpp_
+#define _tmc_test_custom_container_skeletons_hpp_
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+#include <tmc/foundation/custom-iterator-template.hpp>
+#include <tmc/foundation/custom-iterator-template-helper.hpp>
+
+// Skeleton containers for all iterator categories - shared by the tests and the benchmarks
+
+struct CustomElement {
+    CustomElement() = default;
+    CustomElement(int data): data_(data) {}
+
+    inline bool operator==(const CustomElement &other) const { return data_ == other.data_; }
+
+    friend ::std::ostream &operator<<(::std::ostream &stream, const CustomElement &item)
+    {
+        return stream << "{" << item.data_ << "}";
+    }
+    inline void SetValue(int data) { data_=data; }
+    inline int GetValue() const { return data_; }
+
+private:
+    int data_;
+};
+
+struct CustomContainerBase {
+
+    CustomContainerBase() = default;
+    CustomContainerBase(std::initializer_list<int> values){
+        for( const auto &value: values) {
+            InternalData.push_back(CustomElement(value));
+        }
+    }
+
+    std::vector<CustomElement> InternalData;
+    mutable unsigned int IteratorConnectCount=0;
+    mutable unsigned int IteratorDisconnectCount=0;
+
+    typedef std::ptrdiff_t difference_type;
+    typedef size_t size_type;
+    typedef CustomElement value_type;
+    typedef CustomElement* pointer;
+    typedef const CustomElement* const_pointer;
+    typedef CustomElement& reference;
+    typedef const CustomElement& const_reference;
+
+    friend ::std::ostream &operator<<(::std::ostream &stream, const CustomContainerBase &item)
+    {
+        stream << "CustomContainer{";
+        bool successor = false;
+        for(auto const & elem: item.InternalData){
+            if( successor ){
+                stream << ", ";
+            } else {
+                successor = true;
+            }
+
+            stream << elem;
+        }
+        stream << "}";
+        return stream;
+    }
+};
+
+// Skeleton for Input Iterators
+// https://en.cppreference.com/w/cpp/named_req/InputIterator
+struct CustomContainerWithInputIterator: public CustomContainerBase {
+    CustomContainerWithInputIterator() = default;
+    CustomContainerWithInputIterator(std::initializer_list<int> values): CustomContainerBase(values) {}
+
+    template<bool is_const>
+    struct iterator_state {
+
+        typedef std::input_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CustomContainerWithInputIterator, CustomContainerWithInputIterator>::type         container_type;
+        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type                                       value_type;
+        typedef typename std::conditional<is_const, decltype(InternalData)::const_iterator, decltype(InternalData)::iterator>::type internal_iterator;
+
+        container_type * container_;
+        internal_iterator current_;
+
+        // Default Construction without container connection (ALL Iterators)
+        inline iterator_state(): container_(nullptr) {}
+
+        // Construction with connected container; (ALL Iterators)
+        inline iterator_state(container_type * container): container_(container) {
+            ++container_->IteratorConnectCount;
+        }
+
+
+        // Copy Construction from the changeble and const variants - allows changeble to const and vice versa assignment (ALL Iterators)
+        inline iterator_state(const iterator_state<true> & source): container_(source.container_), current_(source.current_) {}
+        inline iterator_state(const iterator_state<false> & source): container_(source.container_), current_(source.current_) {}
+
+        // Destruction (ALL Iterators)
+        inline ~iterator_state() {
+            current_ = internal_iterator();
+            if( container_ != nullptr)
+            { 
+                ++container_->IteratorDisconnectCount;
+                container_ = nullptr; 
+            }
+        }
+
+        // Start and End Positions (ALL Iterators)
+        inline void begin() {current_ = container_->InternalData.begin(); }
+        inline void end() {current_ = container_->InternalData.end(); }
+
+        // Availability and Equality (ALL Iterators)
+        inline bool is_connected() const { return container_ != nullptr; }
+        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
+        inline bool is_equal(const iterator_state<false> & other) const { return current_ == other.current_; }
+
+
+        // Move Next (ALL Iterators)
+        inline void next() { ++current_; }
+
+
+        // Element Access (ALL Iterators)
+        template<typename T = value_type>
+        inline typename std::enable_if<! is_const, T>::type & get() {return *current_; }
+
+        template<typename T = value_type>
+        inline typename std::enable_if<is_const, T>::type & get() const {return *current_; }
+    };
+
+    typedef typename tmc::foundation::custom_iterator_template<iterator_state, false> iterator;
+    typedef typename tmc::foundation::custom_iterator_template<iterator_state, true> const_iterator;
+
+    iterator begin() { return iterator::begin(this); }
+    iterator end() { return iterator::end(this); }
+
+    const_iterator begin() const { return const_iterator::begin(this); }
+    const_iterator end() const { return const_iterator::end(this); }
+
+    const_iterator cbegin() const { return const_iterator::begin(this); }
+    const_iterator cend() const { return const_iterator::end(this); }
+};
+
+// Skeleton for Forward Iterators
+// https://en.cppreference.com/w/cpp/named_req/ForwardIterator
+struct CustomContainerWithForwardIterator: public CustomContainerBase {
+
+    CustomContainerWithForwardIterator() = default;
+    CustomContainerWithForwardIterator(std::initializer_list<int> values): CustomContainerBase(values) {}
+
+
+    template<bool is_const>
+    struct iterator_state {
+
+        // Specifing the type of the specialized iterator - these typedefs are picked up by the template to define the iterators (ALL Iterators)
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CustomContainerWithForwardIterator, CustomContainerWithForwardIterator>::type        container_type;
+        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type            value_type;
+        typedef typename std::conditional<is_const, decltype(InternalData)::const_iterator, decltype(InternalData)::iterator>::type internal_iterator;
+
+        container_type * container_;
+        internal_iterator current_;
+
+        // Default Construction without container connection (ALL Iterators)
+        inline iterator_state(): container_(nullptr) {}
+
+        // Construction with connected container; (ALL Iterators)
+        inline iterator_state(container_type * container): container_(container) {
+            ++container_->IteratorConnectCount;
+        }
+
+
+        // Copy Construction from the changeble and const variants - allows changeble to const and vice versa assignment (ALL Iterators)
+        inline iterator_state(const iterator_state<true> & source): container_(source.container_), current_(source.current_) {}
+        inline iterator_state(const iterator_state<false> & source): container_(source.container_), current_(source.current_) {}
+
+        // Destruction (ALL Iterators)
+        inline ~iterator_state() {
+            current_ = internal_iterator();
+            if( container_ != nullptr)
+            { 
+                ++container_->IteratorDisconnectCount;
+                container_ = nullptr; 
+            }
+        }
+
+        // Start and End Positions (ALL Iterators)
+        inline void begin() {current_ = container_->InternalData.begin(); }
+        inline void end() {current_ = container_->InternalData.end(); }
+
+        // Availability and Equality (ALL Iterators)
+        inline bool is_connected() const { return container_ != nullptr; }
+        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
+        inline bool is_equal(const iterator_state<false> & other) const { return current_ == other.current_; }
+
+
+        // Move Next (ALL Iterators)
+        inline void next() { ++current_; }
+
+
+        // Element Access (ALL Iterators)
+        template<typename T = value_type>
+        inline typename std::enable_if<! is_const, T>::type & get() {return *current_; }
+
+        template<typename T = value_type>
+        inline typename std::enable_if<is_const, T>::type & get() const {return *current_; }
+    };
+
+    typedef tmc::foundation::custom_iterator_template<iterator_state, false> iterator;
+    typedef tmc::foundation::custom_iterator_template<iterator_state, true> const_iterator;
+
+
+    iterator begin() { return iterator::begin(this); }
+    iterator end() { return iterator::end(this); }
+
+    const_iterator begin() const { return const_iterator::begin(this); }
+    const_iterator end() const { return const_iterator::end(this); }
+
+    const_iterator cbegin() const { return const_iterator::begin(this); }
+    const_iterator cend() const { return const_iterator::end(this); }
+};
+
+// Skeleton for Bidirectional Iterators
+// https://en.cppreference.com/w/cpp/named_req/BidirectionalIterator
+struct CustomContainerWithBidirectionalIterator: public CustomContainerBase {
+
+    CustomContainerWithBidirectionalIterator() = default;
+    CustomContainerWithBidirectionalIterator(std::initializer_list<int> values): CustomContainerBase(values) {}
+
+
+    template<bool is_const>
+    struct iterator_state {
+
+        // Specifing the type of the specialized iterator - these typedefs are picked up by the template to define the iterators (ALL Iterators)
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CustomContainerWithBidirectionalIterator, CustomContainerWithBidirectionalIterator>::type        container_type;
+        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type            value_type;
+        typedef typename std::conditional<is_const, decltype(InternalData)::const_iterator, decltype(InternalData)::iterator>::type internal_iterator;
+
+        container_type * container_;
+        internal_iterator current_;
+
+        // Default Construction without container connection (ALL Iterators)
+        inline iterator_state(): container_(nullptr) {}
+
+        // Construction with connected container; (ALL Iterators)
+        inline iterator_state(container_type * container): container_(container) {
+            ++container_->IteratorConnectCount;
+        }
+
+
+        // Copy Construction from the changeble and const variants - allows changeble to const and vice versa assignment (ALL Iterators)
+        inline iterator_state(const iterator_state<true> & source): container_(source.container_), current_(source.current_) {}
+        inline iterator_state(const iterator_state<false> & source): container_(source.container_), current_(source.current_) {}
+
+        // Destruction (ALL Iterators)
+        inline ~iterator_state() {
+            current_ = internal_iterator();
+            if( container_ != nullptr)
+            { 
+                ++container_->IteratorDisconnectCount;
+                container_ = nullptr; 
+            }
+        }
+
+        // Start and End Positions (ALL Iterators)
+        inline void begin() {current_ = container_->InternalData.begin(); }
+        inline void end() {current_ = container_->InternalData.end(); }
+
+        // Availability and Equality (ALL Iterators)
+        inline bool is_connected() const { return container_ != nullptr; }
+        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
+        inline bool is_equal(const iterator_state<false> & other) const { return current_ == other.current_; }
+
+
+        // Move Next (ALL Iterators)
+        inline void next() { ++current_; }
+
+
+        // Element Access (ALL Iterators)
+        template<typename T = value_type>
+        inline typename std::enable_if<! is_const, T>::type & get() {return *current_; }
+
+        template<typename T = value_type>
+        inline typename std::enable_if<is_const, T>::type & get() const {return *current_; }
+
+
+        // Move Previous (Bidirectional, Random Access Iterators)
+        inline void prev() { --current_; }
+    };
+
+    typedef tmc::foundation::custom_iterator_template<iterator_state, false> iterator;
+    typedef tmc::foundation::custom_iterator_template<iterator_state, true> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+
+    iterator begin() { return iterator::begin(this); }
+    iterator end() { return iterator::end(this); }
+
+    const_iterator begin() const { return const_iterator::begin(this); }
+    const_iterator end() const { return const_iterator::end(this); }
+
+    const_iterator cbegin() const { return const_iterator::begin(this); }
+    const_iterator cend() const { return const_iterator::end(this); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+};
+
+// Skeleton for Random Access Iterators
+struct CustomContainerWithRandomAccessIterator: public CustomContainerBase {
+
+    CustomContainerWithRandomAccessIterator() = default;
+    CustomContainerWithRandomAccessIterator(std::initializer_list<int> values): CustomContainerBase(values) {}
+
+
+    template<bool is_const>
+    struct iterator_state {
+
+        // Specifing the type of the specialized iterator - these typedefs are picked up by the template to define the iterators (ALL Iterators)
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CustomContainerWithRandomAccessIterator, CustomContainerWithRandomAccessIterator>::type        container_type;
+        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type            value_type;
+        typedef typename std::conditional<is_const, decltype(InternalData)::const_iterator, decltype(InternalData)::iterator>::type internal_iterator;
+
+        container_type * container_;
+        internal_iterator current_;
+
+        // Default Construction without container connection (ALL Iterators)
+        inline iterator_state(): container_(nullptr) {}
+
+        // Construction with connected container; (ALL Iterators)
+        inline iterator_state(container_type * container): container_(container) {
+            ++container_->IteratorConnectCount;
+        }
+
+
+        // Copy Construction from the changeble and const variants - allows changeble to const and vice versa assignment (ALL Iterators)
+        inline iterator_state(const iterator_state<true> & source): container_(source.container_), current_(source.current_) {}
+        inline iterator_state(const iterator_state<false> & source): container_(source.container_), current_(source.current_) {}
+
+        // Destruction (ALL Iterators)
+        inline ~iterator_state() {
+            current_ = internal_iterator();
+            if( container_ != nullptr)
+            { 
+                ++container_->IteratorDisconnectCount;
+                container_ = nullptr; 
+            }
+        }
+
+        // Start and End Positions (ALL Iterators)
+        inline void begin() {current_ = container_->InternalData.begin(); }
+        inline void end() {current_ = container_->InternalData.end(); }
+
+        // Availability and Equality (ALL Iterators)
+        inline bool is_connected() const { return container_ != nullptr; }
+        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
+        inline bool is_equal(const iterator_state<false> & other) const { return current_ == other.current_; }
+
+
+        // Move Next (ALL Iterators)
+        inline void next() { ++current_; }
+
+
+        // Element Access (ALL Iterators)
+        template<typename T = value_type>
+        inline typename std::enable_if<! is_const, T>::type & get() {return *current_; }
+
+        template<typename T = value_type>
+        inline typename std::enable_if<is_const, T>::type & get() const {return *current_; }
+
+
+        // Move Previous (Bidirectional, Random Access Iterators)
+        inline void prev() { --current_; }
+
+        // Move to position (Random Access Iterators)
+        inline void move(std::ptrdiff_t offset) { current_ += offset; }
+
+        // Calculate Distance (Random Access Iterators)
+        inline std::ptrdiff_t distance(const iterator_state<true> & rhs) const { return current_ - rhs.current_; }
+        inline std::ptrdiff_t distance(const iterator_state<false> & rhs) const { return current_ - rhs.current_; }
+
+
+        // Element access at position (Random Access Iterators)
+        template<typename T = value_type>
+        inline typename std::enable_if<! is_const, T>::type & at(std::ptrdiff_t offset) {return current_[offset]; }
+
+        template<typename T = std::ptrdiff_t>
+        inline value_type & at(typename std::enable_if<is_const, T>::type offset) const {return current_[offset]; }
+    };
+
+    typedef tmc::foundation::custom_iterator_template<iterator_state, false> iterator;
+    typedef tmc::foundation::custom_iterator_template<iterator_state, true> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+
+    iterator begin() { return iterator::begin(this); }
+    iterator end() { return iterator::end(this); }
+
+    const_iterator begin() const { return const_iterator::begin(this); }
+    const_iterator end() const { return const_iterator::end(this); }
+
+    const_iterator cbegin() const { return const_iterator::begin(this); }
+    const_iterator cend() const { return const_iterator::end(this); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+};
+
+// Skeleton for Random Access Iterators with native reverse iteration
+// The container of `CustomContainerWithRandomAccessIterator` with index positions: `rbegin()` / `rend()` make the
+// reverse iterators of SETUP_REVERSE_ITERATORS iterate the state directly, without `std::reverse_iterator`
+struct CustomContainerWithNativeReverseIterator: public CustomContainerBase {
+
+    CustomContainerWithNativeReverseIterator() = default;
+    CustomContainerWithNativeReverseIterator(std::initializer_list<int> values): CustomContainerBase(values) {}
+
+    template<bool is_const>
+    struct iterator_state {
+
+        // Specifing the type of the specialized iterator - these typedefs are picked up by the template to define the iterators (ALL Iterators)
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CustomContainerWithNativeReverseIterator, CustomContainerWithNativeReverseIterator>::type container_type;
+        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type value_type;
+
+        container_type * container_{nullptr};
+        std::ptrdiff_t current_{0};
+
+        // Default Construction without container connection (ALL Iterators)
+        inline iterator_state() = default;
+
+        // Construction with connected container; (ALL Iterators)
+        inline iterator_state(container_type * container): container_(container) {
+            ++container_->IteratorConnectCount;
+        }
+
+        // Copy Construction and Assignment - every copy is connected to the container (ALL Iterators)
+        inline iterator_state(const iterator_state & source): container_(source.container_), current_(source.current_) {
+            if (container_ != nullptr) {
+                ++container_->IteratorConnectCount;
+            }
+        }
+
+        inline iterator_state & operator=(const iterator_state & source) = default;
+
+        // Copy Construction from the changeable variant (ALL Iterators)
+        template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+        inline iterator_state(const iterator_state<other_is_const> & source): container_(source.container_), current_(source.current_) {
+            if (container_ != nullptr) {
+                ++container_->IteratorConnectCount;
+            }
+        }
+
+        // Destruction (ALL Iterators)
+        inline ~iterator_state() {
+            if (container_ != nullptr) {
+                ++container_->IteratorDisconnectCount;
+            }
+        }
+
+        // Start and End Positions (ALL Iterators)
+        inline void begin() { current_ = 0; }
+        inline void end() { current_ = static_cast<std::ptrdiff_t>(container_->InternalData.size()); }
+
+        // Reverse Start and End Positions: the last element and the position before the first element (Native Reverse Iterators)
+        inline void rbegin() { current_ = static_cast<std::ptrdiff_t>(container_->InternalData.size()) - 1; }
+        inline void rend() { current_ = -1; }
+
+        // Availability and Equality (ALL Iterators)
+        inline bool is_connected() const { return container_ != nullptr; }
+
+        template<bool other_is_const>
+        inline bool is_equal(const iterator_state<other_is_const> & other) const { return current_ == other.current_; }
+
+        // Move Next (ALL Iterators)
+        inline void next() { ++current_; }
+
+        // Element Access (ALL Iterators)
+        inline value_type & get() const { return container_->InternalData[static_cast<std::size_t>(current_)]; }
+
+        // Move Previous (Bidirectional, Random Access Iterators)
+        inline void prev() { --current_; }
+
+        // Move to position (Random Access Iterators)
+        inline void move(std::ptrdiff_t offset) { current_ += offset; }
+
+        // Calculate Distance (Random Access Iterators)
+        template<bool other_is_const>
+        inline std::ptrdiff_t distance(const iterator_state<other_is_const> & rhs) const { return current_ - rhs.current_; }
+
+        // Element access at position (Random Access Iterators)
+        inline value_type & at(std::ptrdiff_t offset) const { return container_->InternalData[static_cast<std::size_t>(current_ + offset)]; }
+    };
+
+    SETUP_RANGE_ITERATORS(iterator_state);
+    SETUP_REVERSE_ITERATORS(iterator_state);
+};
+
+#if __cplusplus >= 202002L
+// Skeleton for Contiguous Iterators (C++20)
+// https://en.cppreference.com/w/cpp/iterator/contiguous_iterator
+struct CustomContainerWithContiguousIterator: public CustomContainerBase {
+
+    CustomContainerWithContiguousIterator() = default;
+    CustomContainerWithContiguousIterator(std::initializer_list<int> values): CustomContainerBase(values) {}
+
+
+    template<bool is_const>
+    struct iterator_state {
+
+        // Specifing the type of the specialized iterator - these typedefs are picked up by the template to define the iterators (ALL Iterators)
+        typedef std::contiguous_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CustomContainerWithContiguousIterator, CustomContainerWithContiguousIterator>::type        container_type;
+        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type            value_type;
+        typedef typename std::conditional<is_const, decltype(InternalData)::const_iterator, decltype(InternalData)::iterator>::type internal_iterator;
+
+        container_type * container_;
+        internal_iterator current_;
+
+        // Default Construction without container connection (ALL Iterators)
+        inline iterator_state(): container_(nullptr) {}
+
+        // Construction with connected container; (ALL Iterators)
+        inline iterator_state(container_type * container): container_(container) {
+            ++container_->IteratorConnectCount;
+        }
+
+
+        // Copy Construction from the changeble and const variants - allows changeble to const and vice versa assignment (ALL Iterators)
+        inline iterator_state(const iterator_state<true> & source): container_(source.container_), current_(source.current_) {}
+        inline iterator_state(const iterator_state<false> & source): container_(source.container_), current_(source.current_) {}
+
+        // Destruction (ALL Iterators)
+        inline ~iterator_state() {
+            current_ = internal_iterator();
+            if( container_ != nullptr)
+            { 
+                ++container_->IteratorDisconnectCount;
+                container_ = nullptr; 
+            }
+        }
+
+        // Start and End Positions (ALL Iterators)
+        inline void begin() {current_ = container_->InternalData.begin(); }
+        inline void end() {current_ = container_->InternalData.end(); }
+
+        // Availability and Equality (ALL Iterators)
+        inline bool is_connected() const { return container_ != nullptr; }
+        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
+        inline bool is_equal(const iterator_state<false> & other) const { return current_ == other.current_; }
+
+
+        // Move Next (ALL Iterators)
+        inline void next() { ++current_; }
+
+
+        // Element Access (ALL Iterators)
+        template<typename T = value_type>
+        inline typename std::enable_if<! is_const, T>::type & get() {return *current_; }
+
+        template<typename T = value_type>
+        inline typename std::enable_if<is_const, T>::type & get() const {return *current_; }
+
+
+        // Move Previous (Bidirectional, Random Access Iterators)
+        inline void prev() { --current_; }
+
+        // Move to position (Random Access Iterators)
+        inline void move(std::ptrdiff_t offset) { current_ += offset; }
+
+        // Calculate Distance (Random Access Iterators)
+        inline std::ptrdiff_t distance(const iterator_state<true> & rhs) const { return current_ - rhs.current_; }
+        inline std::ptrdiff_t distance(const iterator_state<false> & rhs) const { return current_ - rhs.current_; }
+
+
+        // Element access at position (Random Access Iterators)
+        template<typename T = value_type>
+        inline typename std::enable_if<! is_const, T>::type & at(std::ptrdiff_t offset) {return current_[offset]; }
+
+        template<typename T = std::ptrdiff_t>
+        inline value_type & at(typename std::enable_if<is_const, T>::type offset) const {return current_[offset]; }
+
+
+        // Element address, valid at the end position too (Contiguous Iterators)
+        inline value_type * address() const { return std::to_address(current_); }
+    };
+
+    typedef tmc::foundation::custom_iterator_template<iterator_state, false> iterator;
+    typedef tmc::foundation::custom_iterator_template<iterator_state, true> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+
+    iterator begin() { return iterator::begin(this); }
+    iterator end() { return iterator::end(this); }
+
+    const_iterator begin() const { return const_iterator::begin(this); }
+    const_iterator end() const { return const_iterator::end(this); }
+
+    const_iterator cbegin() const { return const_iterator::begin(this); }
+    const_iterator cend() const { return const_iterator::end(this); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+};
+
+
+// Skeleton for Input Iterators of a buffered source with chunked access (C++20)
+// The state reads the container through a small buffer, like a file or socket reader,
+// `next_chunk()` hands out the buffered elements as one batch
+struct CustomContainerWithChunkedInputIterator: public CustomContainerBase {
+    static constexpr std::ptrdiff_t BufferSize = 4;
+
+    CustomContainerWithChunkedInputIterator() = default;
+    CustomContainerWithChunkedInputIterator(std::initializer_list<int> values): CustomContainerBase(values) {}
+
+    template<bool is_const>
+    struct iterator_state {
+
+        typedef std::input_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CustomContainerWithChunkedInputIterator, CustomContainerWithChunkedInputIterator>::type   container_type;
+        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type                                               value_type;
+
+        container_type * container_{nullptr};
+        std::ptrdiff_t position_{0};
+        std::ptrdiff_t bufferStart_{0};
+        std::ptrdiff_t bufferSize_{0};
+        CustomElement buffer_[BufferSize];
+
+        // Default Construction without container connection (ALL Iterators)
+        inline iterator_state() = default;
+
+        // Construction with connected container; (ALL Iterators)
+        inline iterator_state(container_type * container): container_(container) {}
+
+        // Copy Construction from the changeble and const variants (ALL Iterators)
+        inline iterator_state(const iterator_state<!is_const> & source): container_(source.container_), position_(source.position_), bufferStart_(source.bufferStart_), bufferSize_(source.bufferSize_) {
+            std::copy(source.buffer_, source.buffer_ + BufferSize, buffer_);
+        }
+
+        // Start and End Positions (ALL Iterators)
+        inline void begin() { position_ = bufferStart_ = bufferSize_ = 0; }
+        inline void end() { position_ = bufferStart_ = static_cast<std::ptrdiff_t>(container_->InternalData.size()); bufferSize_ = 0; }
+
+        // Availability and Equality (ALL Iterators)
+        inline bool is_connected() const { return container_ != nullptr; }
+        inline bool is_equal(const iterator_state<true> & other) const { return position_ == other.position_; }
+        inline bool is_equal(const iterator_state<false> & other) const { return position_ == other.position_; }
+
+
+        // Move Next (ALL Iterators)
+        inline void next() { ++position_; }
+
+
+        // Element Access (ALL Iterators)
+        inline value_type & get() {
+            fill();
+            return buffer_[position_ - bufferStart_];
+        }
+
+
+        // Chunked Access - the buffered elements, refilled before a batch, never while a batch is in use
+        inline std::span<value_type> next_chunk(std::ptrdiff_t max) {
+            fill();
+            const std::ptrdiff_t count = std::min(max, bufferStart_ + bufferSize_ - position_);
+            std::span<value_type> chunk(buffer_ + (position_ - bufferStart_), static_cast<std::size_t>(count));
+            position_ += count;
+            return chunk;
+        }
+
+        // Reads the next elements into the buffer if the current position is not buffered
+        inline void fill() {
+            const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(container_->InternalData.size());
+            if (position_ < bufferStart_ + bufferSize_ || position_ >= size) {
+                return;
+            }
+
+            bufferStart_ = position_;
+            bufferSize_ = std::min(BufferSize, size - position_);
+            std::copy(container_->InternalData.begin() + bufferStart_, container_->InternalData.begin() + bufferStart_ + bufferSize_, buffer_);
+            ++container_->BufferFillCount;
+        }
+    };
+
+    mutable int BufferFillCount = 0;
+
+    typedef typename tmc::foundation::custom_iterator_template<iterator_state, false> iterator;
+    typedef typename tmc::foundation::custom_iterator_template<iterator_state, true> const_iterator;
+
+    iterator begin() { return iterator::begin(this); }
+    iterator end() { return iterator::end(this); }
+
+    const_iterator begin() const { return const_iterator::begin(this); }
+    const_iterator end() const { return const_iterator::end(this); }
+
+    const_iterator cbegin() const { return const_iterator::begin(this); }
+    const_iterator cend() const { return const_iterator::end(this); }
+};
+
+#endif
+
+// Skeleton for Random Access Iterators with a trivially copyable state
+// The state is a container pointer plus an index without connection counting,
+// which makes `iterator` and `const_iterator` trivially copyable as well
+struct CustomContainerWithTrivialIteratorState: public CustomContainerBase {
+
+    CustomContainerWithTrivialIteratorState() = default;
+    CustomContainerWithTrivialIteratorState(std::initializer_list<int> values): CustomContainerBase(values) {}
+
+
+    template<bool is_const>
+    struct iterator_state {
+
+        // Specifing the type of the specialized iterator - these typedefs are picked up by the template to define the iterators (ALL Iterators)
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CustomContainerWithTrivialIteratorState, CustomContainerWithTrivialIteratorState>::type        container_type;
+        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type            value_type;
+
+        // Unconnected states are at index -1, connected states stay in [0, InternalData.size()]
+        static constexpr bool compares_unconnected = true;
+
+        container_type * container_{nullptr};
+        std::ptrdiff_t current_{-1};
+
+        // Default Construction without container connection (ALL Iterators)
+        inline iterator_state() = default;
+
+        // Construction with connected container; (ALL Iterators)
+        inline iterator_state(container_type * container): container_(container) {}
+
+
+        // Copy Construction - defaulted to keep the state trivially copyable (ALL Iterators)
+        inline iterator_state(const iterator_state & source) = default;
+
+        // Copy Construction from the other variant - allows changeble to const and vice versa assignment (ALL Iterators)
+        inline iterator_state(const iterator_state<!is_const> & source): container_(source.container_), current_(source.current_) {}
+
+        // Start and End Positions (ALL Iterators)
+        inline void begin() {current_ = 0; }
+        inline void end() {current_ = static_cast<std::ptrdiff_t>(container_->InternalData.size()); }
+
+        // Availability and Equality (ALL Iterators)
+        inline bool is_connected() const { return container_ != nullptr; }
+        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
+        inline bool is_equal(const iterator_state<false> & other) const { return current_ == other.current_; }
+
+
+        // Move Next (ALL Iterators)
+        inline void next() { ++current_; }
+
+
+        // Element Access (ALL Iterators)
+        template<typename T = value_type>
+        inline typename std::enable_if<! is_const, T>::type & get() {return container_->InternalData[current_]; }
+
+        template<typename T = value_type>
+        inline typename std::enable_if<is_const, T>::type & get() const {return container_->InternalData[current_]; }
+
+
+        // Move Previous (Bidirectional, Random Access Iterators)
+        inline void prev() { --current_; }
+
+        // Move to position (Random Access Iterators)
+        inline void move(std::ptrdiff_t offset) { current_ += offset; }
+
+        // Calculate Distance (Random Access Iterators)
+        inline std::ptrdiff_t distance(const iterator_state<true> & rhs) const { return current_ - rhs.current_; }
+        inline std::ptrdiff_t distance(const iterator_state<false> & rhs) const { return current_ - rhs.current_; }
+
+
+        // Element access at position (Random Access Iterators)
+        template<typename T = value_type>
+        inline typename std::enable_if<! is_const, T>::type & at(std::ptrdiff_t offset) {return container_->InternalData[current_ + offset]; }
+
+        template<typename T = std::ptrdiff_t>
+        inline value_type & at(typename std::enable_if<is_const, T>::type offset) const {return container_->InternalData[current_ + offset]; }
+    };
+
+    typedef tmc::foundation::custom_iterator_template<iterator_state, false> iterator;
+    typedef tmc::foundation::custom_iterator_template<iterator_state, true> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+
+    iterator begin() { return iterator::begin(this); }
+    iterator end() { return iterator::end(this); }
+
+    const_iterator begin() const { return const_iterator::begin(this); }
+    const_iterator end() const { return const_iterator::end(this); }
+
+    const_iterator cbegin() const { return const_iterator::begin(this); }
+    const_iterator cend() const { return const_iterator::end(this); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+};
+
+
+// Skeleton for Random Access Iterators with a pointer backed state
+// The state is a container pointer plus an element pointer and declares `collapses_to_pointer`:
+// unchecked iterators store the element pointer only
+struct CustomContainerWithPointerIteratorState: public CustomContainerBase {
+
+    CustomContainerWithPointerIteratorState() = default;
+    CustomContainerWithPointerIteratorState(std::initializer_list<int> values): CustomContainerBase(values) {}
+
+
+    template<bool is_const>
+    struct iterator_state {
+
+        // Specifing the type of the specialized iterator - these typedefs are picked up by the template to define the iterators (ALL Iterators)
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CustomContainerWithPointerIteratorState, CustomContainerWithPointerIteratorState>::type        container_type;
+        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type            value_type;
+
+        // Unconnected states have a null element pointer, equal to the positions of empty containers only
+        static constexpr bool compares_unconnected = true;
+
+        // A position in the contiguous element vector, nothing else (Collapsing Iterators)
+        static constexpr bool collapses_to_pointer = true;
+
+        container_type * container_{nullptr};
+        value_type * current_{nullptr};
+
+        // Default Construction without container connection (ALL Iterators)
+        inline iterator_state() = default;
+
+        // Construction with connected container; (ALL Iterators)
+        inline iterator_state(container_type * container): container_(container) {}
+
+        // Copy Construction from the changeable variant (ALL Iterators)
+        template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+        inline iterator_state(const iterator_state<other_is_const> & source): container_(source.container_), current_(source.current_) {}
+
+        // Start and End Positions (ALL Iterators)
+        inline void begin() { current_ = container_->InternalData.data(); }
+        inline void end() { current_ = container_->InternalData.data() + container_->InternalData.size(); }
+
+        // Availability and Equality (ALL Iterators)
+        inline bool is_connected() const { return container_ != nullptr; }
+
+        template<bool other_is_const>
+        inline bool is_equal(const iterator_state<other_is_const> & other) const { return current_ == other.current_; }
+
+        // Move Next (ALL Iterators)
+        inline void next() { ++current_; }
+
+        // Element Access (ALL Iterators)
+        inline value_type & get() const { return *current_; }
+
+        // Raw address of the current element, the collapsed iterator (Collapsing Iterators)
+        inline value_type * address() const { return current_; }
+
+        // Move Previous (Bidirectional, Random Access Iterators)
+        inline void prev() { --current_; }
+
+        // Move to position (Random Access Iterators)
+        inline void move(std::ptrdiff_t offset) { current_ += offset; }
+
+        // Calculate Distance (Random Access Iterators)
+        template<bool other_is_const>
+        inline std::ptrdiff_t distance(const iterator_state<other_is_const> & rhs) const { return current_ - rhs.current_; }
+
+        // Element access at position (Random Access Iterators)
+        inline value_type & at(std::ptrdiff_t offset) const { return current_[offset]; }
+    };
+
+    SETUP_RANGE_ITERATORS(iterator_state);
+    SETUP_REVERSE_ITERATORS(iterator_state);
+};
+
+// Skeleton for Random Access Iterators usable in constant expressions
+// A literal fixed size array with `constexpr` state hooks: iterable during constant evaluation
+template<std::size_t Size>
+struct CustomConstexprArray {
+    int elements_[Size];
+
+    constexpr std::size_t size() const { return Size; }
+
+    template<bool is_const>
+    struct iterator_state {
+
+        // Specifing the type of the specialized iterator - these typedefs are picked up by the template to define the iterators (ALL Iterators)
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CustomConstexprArray, CustomConstexprArray>::type container_type;
+        typedef typename std::conditional<is_const, const int, int>::type value_type;
+
+        // Unconnected states are at index -1, connected states stay in [0, Size]
+        static constexpr bool compares_unconnected = true;
+
+        container_type * container_{nullptr};
+        std::ptrdiff_t current_{-1};
+
+        // Default Construction without container connection (ALL Iterators)
+        constexpr iterator_state() = default;
+
+        // Construction with connected container; (ALL Iterators)
+        constexpr iterator_state(container_type * container): container_(container) {}
+
+        // Copy Construction from the changeable variant (ALL Iterators)
+        template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+        constexpr iterator_state(const iterator_state<other_is_const> & source): container_(source.container_), current_(source.current_) {}
+
+        // Start and End Positions (ALL Iterators)
+        constexpr void begin() { current_ = 0; }
+        constexpr void end() { current_ = static_cast<std::ptrdiff_t>(Size); }
+
+        // Availability and Equality (ALL Iterators)
+        constexpr bool is_connected() const { return container_ != nullptr; }
+
+        template<bool other_is_const>
+        constexpr bool is_equal(const iterator_state<other_is_const> & other) const { return current_ == other.current_; }
+
+        // Move Next (ALL Iterators)
+        constexpr void next() { ++current_; }
+
+        // Element Access (ALL Iterators)
+        constexpr value_type & get() const { return container_->elements_[current_]; }
+
+        // Move Previous (Bidirectional, Random Access Iterators)
+        constexpr void prev() { --current_; }
+
+        // Move to position (Random Access Iterators)
+        constexpr void move(std::ptrdiff_t offset) { current_ += offset; }
+
+        // Calculate Distance (Random Access Iterators)
+        template<bool other_is_const>
+        constexpr std::ptrdiff_t distance(const iterator_state<other_is_const> & rhs) const { return current_ - rhs.current_; }
+
+        // Element access at position (Random Access Iterators)
+        constexpr value_type & at(std::ptrdiff_t offset) const { return container_->elements_[current_ + offset]; }
+    };
+
+    SETUP_CONSTEXPR_ITERATORS(iterator_state);
+    SETUP_CONSTEXPR_REVERSE_ITERATORS(iterator_state);
+};
+
+// Skeleton for Forward Iterators with a sentinel end
+// The state implements `is_end()` instead of `end()`, the SETUP_* macros make `end()` return a `custom_iterator_sentinel`
+struct CustomContainerWithSentinel: public CustomContainerBase {
+
+    CustomContainerWithSentinel() = default;
+    CustomContainerWithSentinel(std::initializer_list<int> values): CustomContainerBase(values) {}
+
+
+    template<bool is_const>
+    struct iterator_state {
+
+        // Specifing the type of the specialized iterator - these typedefs are picked up by the template to define the iterators (ALL Iterators)
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename std::conditional<is_const, const CustomContainerWithSentinel, CustomContainerWithSentinel>::type        container_type;
+        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type            value_type;
+        typedef typename std::conditional<is_const, decltype(InternalData)::const_iterator, decltype(InternalData)::iterator>::type internal_iterator;
+
+        container_type * container_;
+        internal_iterator current_;
+
+        // Default Construction without container connection (ALL Iterators)
+        inline iterator_state(): container_(nullptr) {}
+
+        // Construction with connected container; (ALL Iterators)
+        inline iterator_state(container_type * container): container_(container) {
+            ++container_->IteratorConnectCount;
+        }
+
+
+        // Copy Construction from the changeble and const variants - allows changeble to const and vice versa assignment (ALL Iterators)
+        inline iterator_state(const iterator_state<true> & source): container_(source.container_), current_(source.current_) {}
+        inline iterator_state(const iterator_state<false> & source): container_(source.container_), current_(source.current_) {}
+
+        // Destruction (ALL Iterators)
+        inline ~iterator_state() {
+            current_ = internal_iterator();
+            if( container_ != nullptr)
+            { 
+                ++container_->IteratorDisconnectCount;
+                container_ = nullptr; 
+            }
+        }
+
+        // Start Position (ALL Iterators)
+        inline void begin() {current_ = container_->InternalData.begin(); }
+
+        // End Position as sentinel test - replaces `end()` (ALL Iterators)
+        inline bool is_end() const { return current_ == container_->InternalData.end(); }
+
+        // Availability and Equality (ALL Iterators)
+        inline bool is_connected() const { return container_ != nullptr; }
+        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
+        inline bool is_equal(const iterator_state<false> & other) const { return current_ == other.current_; }
+
+
+        // Move Next (ALL Iterators)
+        inline void next() { ++current_; }
+
+
+        // Element Access (ALL Iterators)
+        template<typename T = value_type>
+        inline typename std::enable_if<! is_const, T>::type & get() {return *current_; }
+
+        template<typename T = value_type>
+        inline typename std::enable_if<is_const, T>::type & get() const {return *current_; }
+    };
+
+    SETUP_RANGE_ITERATORS(iterator_state);
+};
+
+#endif
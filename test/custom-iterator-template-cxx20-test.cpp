@@ -0,0 +1,283 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT 
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/custom-iterator-template.hpp>
+#include "custom-container-skeletons.hpp"
+#include "block-container.hpp"
+#include "sample-container.hpp"
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+// ****************************** Contiguous Iterator Test *********************************************
+// https://en.cppreference.com/w/cpp/iterator/contiguous_iterator
+
+static_assert(std::contiguous_iterator<CustomContainerWithContiguousIterator::iterator>, "Contiguous states must produce contiguous iterators");
+static_assert(std::contiguous_iterator<CustomContainerWithContiguousIterator::const_iterator>, "Contiguous states must produce contiguous const iterators");
+static_assert(std::random_access_iterator<CustomContainerWithRandomAccessIterator::iterator>, "Random access states must produce random access iterators");
+static_assert(std::random_access_iterator<CustomContainerWithRandomAccessIterator::const_iterator>, "Random access states must produce random access const iterators");
+static_assert(! std::contiguous_iterator<CustomContainerWithRandomAccessIterator::iterator>, "Random access states must not produce contiguous iterators");
+
+TEST(IteratorTemplateCxx20, TestContiguousIteratorTypeTraits) {
+    EXPECT_EQ(typeid(std::iterator_traits<CustomContainerWithContiguousIterator::iterator>::iterator_category), typeid(std::random_access_iterator_tag));
+    EXPECT_EQ(typeid(CustomContainerWithContiguousIterator::iterator::iterator_concept), typeid(std::contiguous_iterator_tag));
+    EXPECT_EQ(typeid(CustomContainerWithContiguousIterator::const_iterator::iterator_concept), typeid(std::contiguous_iterator_tag));
+}
+
+TEST(IteratorTemplateCxx20, TestContiguousIteratorToAddress) {
+    CustomContainerWithContiguousIterator container{1,2,3};
+    const CustomContainerWithContiguousIterator &constContainer = container;
+
+    EXPECT_EQ(std::to_address(container.begin()), container.InternalData.data());
+    EXPECT_EQ(std::to_address(container.end()), container.InternalData.data() + 3);
+    EXPECT_EQ(std::to_address(constContainer.begin() + 1), container.InternalData.data() + 1);
+    EXPECT_EQ(container.begin()->GetValue(), 1);
+}
+
+TEST(IteratorTemplateCxx20, TestContiguousIteratorSpanConstruction) {
+    CustomContainerWithContiguousIterator container{1,2,3};
+    const CustomContainerWithContiguousIterator &constContainer = container;
+
+    std::span<CustomElement> span(container.begin(), container.end());
+    std::span<const CustomElement> constSpan(constContainer.begin(), constContainer.end());
+
+    EXPECT_EQ(span.data(), container.InternalData.data());
+    EXPECT_EQ(span.size(), 3u);
+    EXPECT_EQ(constSpan.data(), container.InternalData.data());
+    EXPECT_EQ(constSpan.size(), 3u);
+}
+
+TEST(IteratorTemplateCxx20, TestContiguousIteratorAlgorithms) {
+    CustomContainerWithContiguousIterator container{1,2,3};
+    CustomContainerWithContiguousIterator target{0,0,0};
+
+    std::copy(container.begin(), container.end(), target.begin());
+    EXPECT_TRUE(std::equal(container.begin(), container.end(), target.begin()));
+
+    std::fill(target.begin(), target.end(), CustomElement(7));
+    EXPECT_THAT(target.InternalData, ::testing::ContainerEq(std::vector<CustomElement>({7,7,7})));
+
+    std::ranges::copy(container, target.begin());
+    EXPECT_THAT(target.InternalData, ::testing::ContainerEq(std::vector<CustomElement>({1,2,3})));
+}
+
+
+// ****************************** Sentinel Test *********************************************
+// https://en.cppreference.com/w/cpp/iterator/sentinel_for
+
+static_assert(std::sentinel_for<custom_iterator_sentinel, CustomContainerWithSentinel::iterator>, "custom_iterator_sentinel must be a sentinel for states implementing is_end()");
+static_assert(std::sentinel_for<custom_iterator_sentinel, CustomContainerWithSentinel::const_iterator>, "custom_iterator_sentinel must be a sentinel for states implementing is_end()");
+static_assert(! std::sentinel_for<custom_iterator_sentinel, CustomContainerWithRandomAccessIterator::iterator>, "custom_iterator_sentinel must not be a sentinel for states without is_end()");
+static_assert(std::ranges::forward_range<CustomContainerWithSentinel>, "Containers with sentinel end must be ranges");
+
+TEST(IteratorTemplateCxx20, TestSentinelRangesAlgorithms) {
+    CustomContainerWithSentinel container{1,2,3};
+
+    EXPECT_EQ(std::ranges::distance(container), 3);
+    EXPECT_EQ(*std::ranges::find(container, CustomElement(2)), CustomElement(2));
+    EXPECT_TRUE(std::ranges::find(container, CustomElement(4)) == container.end());
+}
+
+
+// ****************************** Chunked Access Test *********************************************
+
+static int ValueOf(const CustomElement &element) { return element.GetValue(); }
+static int ValueOf(int value) { return value; }
+
+// Collects the batches of `next_chunk()` until the empty batch
+template<typename TIterator, typename TLast>
+static std::vector<std::vector<int>> CollectChunks(TIterator it, const TLast &last, std::ptrdiff_t max) {
+    std::vector<std::vector<int>> chunks;
+    for (auto chunk = it.next_chunk(last, max); !chunk.empty(); chunk = it.next_chunk(last, max)) {
+        std::vector<int> values;
+        for (const auto &element: chunk) {
+            values.push_back(ValueOf(element));
+        }
+        chunks.push_back(values);
+    }
+    return chunks;
+}
+
+TEST(IteratorTemplateCxx20, TestNextChunkOfContiguousIterators) {
+    CustomContainerWithContiguousIterator container{1,2,3,4,5};
+
+    auto it = container.begin();
+    std::span<CustomElement> chunk = it.next_chunk(container.end(), 2);
+
+    EXPECT_EQ(chunk.data(), container.InternalData.data());
+    EXPECT_EQ(chunk.size(), 2u);
+    EXPECT_TRUE(it == container.begin() + 2);
+    EXPECT_THAT(CollectChunks(container.begin(), container.end(), 2), ::testing::ContainerEq(std::vector<std::vector<int>>({{1,2},{3,4},{5}})));
+    EXPECT_THAT(CollectChunks(container.cbegin() + 1, container.cend() - 1, 100), ::testing::ContainerEq(std::vector<std::vector<int>>({{2,3,4}})));
+    EXPECT_TRUE(container.begin().next_chunk(container.end(), 0).empty());
+    EXPECT_TRUE(container.end().next_chunk(container.end(), 10).empty());
+}
+
+TEST(IteratorTemplateCxx20, TestNextChunkFallbackForForwardIterators) {
+    CustomContainerWithRandomAccessIterator randomAccess{1,2,3};
+    CustomContainerWithForwardIterator forward{1,2,3};
+    CustomContainerWithSentinel sentinel{1,2,3};
+
+    auto it = forward.begin();
+    std::span<CustomElement> chunk = it.next_chunk(forward.end(), 10);
+
+    EXPECT_EQ(chunk.data(), forward.InternalData.data());
+    EXPECT_THAT(CollectChunks(randomAccess.begin(), randomAccess.end(), 10), ::testing::ContainerEq(std::vector<std::vector<int>>({{1},{2},{3}})));
+    EXPECT_THAT(CollectChunks(forward.cbegin(), forward.cend(), 10), ::testing::ContainerEq(std::vector<std::vector<int>>({{1},{2},{3}})));
+    EXPECT_THAT(CollectChunks(sentinel.begin(), sentinel.end(), 10), ::testing::ContainerEq(std::vector<std::vector<int>>({{1},{2},{3}})));
+}
+
+TEST(IteratorTemplateCxx20, TestNextChunkOfBufferedInputIterators) {
+    CustomContainerWithChunkedInputIterator container{1,2,3,4,5,6,7,8,9,10};
+
+    EXPECT_THAT(CollectChunks(container.begin(), container.end(), 3), ::testing::ContainerEq(std::vector<std::vector<int>>({{1,2,3},{4},{5,6,7},{8},{9,10}})));
+    EXPECT_EQ(container.BufferFillCount, 3);
+    EXPECT_THAT(CollectChunks(container.cbegin(), container.cend(), 10), ::testing::ContainerEq(std::vector<std::vector<int>>({{1,2,3,4},{5,6,7,8},{9,10}})));
+}
+
+TEST(IteratorTemplateCxx20, TestNextChunkMixedWithElementAccess) {
+    CustomContainerWithChunkedInputIterator container{1,2,3,4,5,6};
+
+    auto it = container.begin();
+    EXPECT_EQ(*it, CustomElement(1));
+    ++it;
+    EXPECT_THAT(CollectChunks(it, container.end(), 10), ::testing::ContainerEq(std::vector<std::vector<int>>({{2,3,4},{5,6}})));
+
+    it.next_chunk(container.end(), 10);
+    EXPECT_EQ(*it, CustomElement(5));
+}
+
+TEST(IteratorTemplateCxx20, TestNextChunkOfSegmentedContainers) {
+    BlockContainer<int, 4> container{1,2,3,4,5,6,7,8,9,10};
+
+    EXPECT_THAT(CollectChunks(container.begin(), container.end(), 100), ::testing::ContainerEq(std::vector<std::vector<int>>({{1,2,3,4},{5,6,7,8},{9,10}})));
+    EXPECT_THAT(CollectChunks(container.cbegin() + 2, container.cend() - 1, 3), ::testing::ContainerEq(std::vector<std::vector<int>>({{3,4},{5,6,7},{8},{9}})));
+}
+
+
+// ****************************** Concepts and Ranges Test *********************************************
+// https://en.cppreference.com/w/cpp/iterator#C.2B.2B20_iterator_concepts
+// https://en.cppreference.com/w/cpp/ranges
+
+// Iterator concepts of all categories, for the changeable and the const variant
+template<typename TContainer, template<typename> typename TConcept>
+constexpr bool models_iterator_concept = TConcept<typename TContainer::iterator>::value && TConcept<typename TContainer::const_iterator>::value;
+
+template<typename TIterator> struct is_input_iterator: std::bool_constant<std::input_iterator<TIterator>> {};
+template<typename TIterator> struct is_forward_iterator: std::bool_constant<std::forward_iterator<TIterator>> {};
+template<typename TIterator> struct is_bidirectional_iterator: std::bool_constant<std::bidirectional_iterator<TIterator>> {};
+template<typename TIterator> struct is_random_access_iterator: std::bool_constant<std::random_access_iterator<TIterator>> {};
+
+static_assert(models_iterator_concept<CustomContainerWithInputIterator, is_input_iterator>, "Input states must produce input iterators");
+static_assert(! std::forward_iterator<CustomContainerWithInputIterator::iterator>, "Input states must not produce forward iterators");
+static_assert(models_iterator_concept<CustomContainerWithChunkedInputIterator, is_input_iterator>, "Input states must produce input iterators");
+static_assert(models_iterator_concept<CustomContainerWithForwardIterator, is_forward_iterator>, "Forward states must produce forward iterators");
+static_assert(! std::bidirectional_iterator<CustomContainerWithForwardIterator::iterator>, "Forward states must not produce bidirectional iterators");
+static_assert(models_iterator_concept<CustomContainerWithBidirectionalIterator, is_bidirectional_iterator>, "Bidirectional states must produce bidirectional iterators");
+static_assert(! std::random_access_iterator<CustomContainerWithBidirectionalIterator::iterator>, "Bidirectional states must not produce random access iterators");
+static_assert(models_iterator_concept<CustomContainerWithRandomAccessIterator, is_random_access_iterator>, "Random access states must produce random access iterators");
+static_assert(models_iterator_concept<CustomContainerWithTrivialIteratorState, is_random_access_iterator>, "Random access states must produce random access iterators");
+static_assert(models_iterator_concept<SampleContainer, is_random_access_iterator>, "Random access states must produce random access iterators");
+static_assert(models_iterator_concept<BlockContainer<int>, is_random_access_iterator>, "Random access states must produce random access iterators");
+static_assert(std::sortable<CustomContainerWithRandomAccessIterator::iterator, std::ranges::less, decltype(&CustomElement::GetValue)>, "Random access iterators must be sortable");
+static_assert(std::sortable<SampleContainer::iterator, std::ranges::less, decltype(&SampleElement::member_)>, "Random access iterators must be sortable");
+static_assert(std::sized_sentinel_for<SampleContainer::const_iterator, SampleContainer::iterator>, "Const and changeable iterators must be mutual sized sentinels");
+static_assert(std::totally_ordered_with<SampleContainer::const_iterator, SampleContainer::iterator>, "Const and changeable iterators must be mutually ordered");
+
+// Ranges of the SETUP_* macro containers
+static_assert(std::ranges::random_access_range<SampleContainer>, "SETUP_RANGE_ITERATORS containers must be ranges");
+static_assert(std::ranges::random_access_range<const SampleContainer>, "SETUP_RANGE_ITERATORS containers must be const ranges");
+static_assert(std::ranges::sized_range<SampleContainer> && std::ranges::common_range<SampleContainer>, "Random access containers must be sized common ranges");
+static_assert(std::ranges::random_access_range<BlockContainer<int>> && std::ranges::random_access_range<const BlockContainer<int>>, "SETUP_RANGE_ITERATORS containers must be ranges");
+static_assert(std::ranges::forward_range<const CustomContainerWithSentinel>, "SETUP_RANGE_ITERATORS containers with sentinel must be const ranges");
+static_assert(! std::ranges::common_range<CustomContainerWithSentinel>, "Containers with sentinel must not be common ranges");
+
+// Views and borrowed ranges
+static_assert(std::ranges::view<SampleContainer>, "SETUP_BORROWED_VIEW containers must be views");
+static_assert(std::ranges::borrowed_range<SampleContainer>, "SETUP_BORROWED_VIEW containers must be borrowed ranges");
+static_assert(std::ranges::viewable_range<SampleContainer>, "SETUP_BORROWED_VIEW containers must be viewable as rvalues");
+static_assert(! std::ranges::view<BlockContainer<int>>, "Owning containers must not be views");
+static_assert(! std::ranges::borrowed_range<BlockContainer<int>>, "Owning containers must not be borrowed ranges");
+static_assert(std::ranges::viewable_range<BlockContainer<int> &>, "Owning containers must be viewable as lvalues");
+
+TEST(IteratorTemplateCxx20, TestLazyViewPipelines) {
+    SampleElement elements[] = {{1},{2},{3},{4},{5},{6}};
+    SampleContainer container(elements, 6);
+
+    std::vector<int> values;
+    for (int value: SampleContainer(elements, 6)
+            | std::views::filter([](const SampleElement &element) { return element.member_ % 2 == 0; })
+            | std::views::transform([](const SampleElement &element) { return element.member_ * 10; })) {
+        values.push_back(value);
+    }
+
+    auto reversed = container | std::views::reverse | std::views::take(2);
+
+    EXPECT_THAT(values, ::testing::ContainerEq(std::vector<int>({20,40,60})));
+    EXPECT_EQ((*reversed.begin()).member_, 6);
+    EXPECT_EQ(std::ranges::distance(reversed), 2);
+    EXPECT_EQ((container | std::views::drop(4)).size(), 2u);
+}
+
+TEST(IteratorTemplateCxx20, TestBorrowedRangeIteratorsOutliveTheContainer) {
+    SampleElement elements[] = {{3},{1},{2}};
+
+    auto found = std::ranges::find_if(SampleContainer(elements, 3), [](const SampleElement &element) { return element.member_ == 2; });
+    static_assert(std::is_same_v<decltype(found), SampleContainer::iterator>, "Borrowed ranges must not return std::ranges::dangling");
+
+    EXPECT_EQ(found->member_, 2);
+    EXPECT_EQ(&*found, &elements[2]);
+}
+
+TEST(IteratorTemplateCxx20, TestRangesAlgorithmsOnCustomContainers) {
+    SampleElement elements[] = {{3},{1},{2}};
+    SampleContainer container(elements, 3);
+    BlockContainer<int, 4> blocks{5,4,3,2,1,0};
+    const BlockContainer<int, 4> &constBlocks = blocks;
+
+    std::ranges::sort(container, {}, &SampleElement::member_);
+    std::ranges::sort(blocks);
+
+    EXPECT_EQ(elements[0].member_, 1);
+    EXPECT_EQ(elements[2].member_, 3);
+    EXPECT_TRUE(std::ranges::is_sorted(constBlocks));
+    EXPECT_EQ(std::ranges::size(constBlocks), 6u);
+    EXPECT_EQ(*std::ranges::max_element(constBlocks | std::views::take(3)), 2);
+}
+
+// ****************************** Constant Evaluation Test *********************************************
+
+constexpr CustomConstexprArray<6> ConstexprElements{{4, 8, 15, 16, 23, 42}};
+
+static_assert(std::accumulate(ConstexprElements.begin(), ConstexprElements.end(), 0) == 108, "std::accumulate runs in constant expressions");
+static_assert(std::find(ConstexprElements.begin(), ConstexprElements.end(), 16) - ConstexprElements.begin() == 3, "std::find runs in constant expressions");
+static_assert(std::find(ConstexprElements.rbegin(), ConstexprElements.rend(), 8) - ConstexprElements.rbegin() == 4, "std::find on reverse iterators runs in constant expressions");
+static_assert(std::ranges::find(ConstexprElements, 99) == ConstexprElements.end(), "std::ranges::find runs in constant expressions");
+static_assert(std::ranges::is_sorted(ConstexprElements), "Range algorithms run in constant expressions");
+
+constexpr CustomConstexprArray<6> ConstexprSorted() {
+    CustomConstexprArray<6> elements{{42, 23, 16, 15, 8, 4}};
+    std::sort(elements.begin(), elements.end());
+    return elements;
+}
+
+constexpr CustomConstexprArray<6> ConstexprSortedElements = ConstexprSorted();
+
+static_assert(std::ranges::equal(ConstexprSortedElements, ConstexprElements), "Mutating algorithms run in constant expressions");
+
+TEST(IteratorTemplateCxx20, TestConstexprAlgorithmsAtRuntime) {
+    CustomConstexprArray<6> elements = ConstexprSorted();
+    EXPECT_EQ(std::accumulate(elements.begin(), elements.end(), 0), 108);
+    EXPECT_EQ(*std::find(elements.begin(), elements.end(), 23), 23);
+}
@@ -1,6 +1,7 @@
 // Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
 // Licensed under MIT 
 
+#include <functional>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -10,417 +11,13 @@
 #include <gmock/gmock.h>
 #include <gmock/gmock-matchers.h>
 #include <tmc/foundation/custom-iterator-template.hpp>
+#include <tmc/foundation/custom-iterator-template-helper.hpp>
+#include "custom-container-skeletons.hpp"
 
 using namespace std;
 using namespace testing;
 using namespace tmc::foundation;
 
-struct CustomElement {
-    CustomElement() = default;
-    CustomElement(int data): data_(data) {}
-
-    inline bool operator==(const CustomElement &other) const { return data_ == other.data_; }
-
-    friend ::std::ostream &operator<<(::std::ostream &stream, const CustomElement &item)
-    {
-        return stream << "{" << item.data_ << "}";
-    }
-    inline void SetValue(int data) { data_=data; }
-    inline int GetValue() const { return data_; }
-
-private:
-    int data_;
-};
-
-struct CustomContainerBase {
-
-    CustomContainerBase() = default;
-    CustomContainerBase(std::initializer_list<int> values){
-        for( const auto &value: values) {
-            InternalData.push_back(CustomElement(value));
-        }
-    }
-
-    std::vector<CustomElement> InternalData;
-    mutable unsigned int IteratorConnectCount=0;
-    mutable unsigned int IteratorDisconnectCount=0;
-
-    typedef std::ptrdiff_t difference_type;
-    typedef size_t size_type;
-    typedef CustomElement value_type;
-    typedef CustomElement* pointer;
-    typedef const CustomElement* const_pointer;
-    typedef CustomElement& reference;
-    typedef const CustomElement& const_reference;
-
-    friend ::std::ostream &operator<<(::std::ostream &stream, const CustomContainerBase &item)
-    {
-        stream << "CustomContainer{";
-        bool successor = false;
-        for(auto const & elem: item.InternalData){
-            if( successor ){
-                stream << ", ";
-            } else {
-                successor = true;
-            }
-
-            stream << elem;
-        }
-        stream << "}";
-        return stream;
-    }
-};
-
-// Skeleton for Input Iterators
-// https://en.cppreference.com/w/cpp/named_req/InputIterator
-struct CustomContainerWithInputIterator: public CustomContainerBase {
-    CustomContainerWithInputIterator() = default;
-    CustomContainerWithInputIterator(std::initializer_list<int> values): CustomContainerBase(values) {}
-
-    template<bool is_const>
-    struct iterator_state {
-
-        typedef std::input_iterator_tag iterator_category;
-        typedef typename std::conditional<is_const, const CustomContainerWithInputIterator, CustomContainerWithInputIterator>::type         container_type;
-        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type                                       value_type;
-        typedef typename std::conditional<is_const, decltype(InternalData)::const_iterator, decltype(InternalData)::iterator>::type internal_iterator;
-
-        container_type * container_;
-        internal_iterator current_;
-
-        // Default Construction without container connection (ALL Iterators)
-        inline iterator_state(): container_(nullptr) {}
-
-        // Construction with connected container; (ALL Iterators)
-        inline iterator_state(container_type * container): container_(container) {
-            ++container_->IteratorConnectCount;
-        }
-
-
-        // Copy Construction from the changeble and const variants - allows changeble to const and vice versa assignment (ALL Iterators)
-        inline iterator_state(const iterator_state<true> & source): container_(source.container_), current_(source.current_) {}
-        inline iterator_state(const iterator_state<false> & source): container_(source.container_), current_(source.current_) {}
-
-        // Destruction (ALL Iterators)
-        inline ~iterator_state() {
-            current_ = internal_iterator();
-            if( container_ != nullptr)
-            { 
-                ++container_->IteratorDisconnectCount;
-                container_ = nullptr; 
-            }
-        }
-
-        // Start and End Positions (ALL Iterators)
-        inline void begin() {current_ = container_->InternalData.begin(); }
-        inline void end() {current_ = container_->InternalData.end(); }
-
-        // Availability and Equality (ALL Iterators)
-        inline bool is_connected() const { return container_ != nullptr; }
-        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
-        inline bool is_equal(const iterator_state<false> & other) const { return current_ == other.current_; }
-
-
-        // Move Next (ALL Iterators)
-        inline void next() { ++current_; }
-
-
-        // Element Access (ALL Iterators)
-        template<typename T = value_type>
-        inline typename std::enable_if<! is_const, T>::type & get() {return *current_; }
-
-        template<typename T = value_type>
-        inline typename std::enable_if<is_const, T>::type & get() const {return *current_; }
-    };
-
-    typedef typename tmc::foundation::custom_iterator_template<iterator_state, false> iterator;
-    typedef typename tmc::foundation::custom_iterator_template<iterator_state, true> const_iterator;
-
-    iterator begin() { return iterator::begin(this); }
-    iterator end() { return iterator::end(this); }
-
-    const_iterator begin() const { return const_iterator::begin(this); }
-    const_iterator end() const { return const_iterator::end(this); }
-
-    const_iterator cbegin() const { return const_iterator::begin(this); }
-    const_iterator cend() const { return const_iterator::end(this); }
-};
-
-// Skeleton for Forward Iterators
-// https://en.cppreference.com/w/cpp/named_req/ForwardIterator
-struct CustomContainerWithForwardIterator: public CustomContainerBase {
-
-    CustomContainerWithForwardIterator() = default;
-    CustomContainerWithForwardIterator(std::initializer_list<int> values): CustomContainerBase(values) {}
-
-
-    template<bool is_const>
-    struct iterator_state {
-
-        // Specifing the type of the specialized iterator - these typedefs are picked up by the template to define the iterators (ALL Iterators)
-        typedef std::forward_iterator_tag iterator_category;
-        typedef typename std::conditional<is_const, const CustomContainerWithForwardIterator, CustomContainerWithForwardIterator>::type        container_type;
-        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type            value_type;
-        typedef typename std::conditional<is_const, decltype(InternalData)::const_iterator, decltype(InternalData)::iterator>::type internal_iterator;
-
-        container_type * container_;
-        internal_iterator current_;
-
-        // Default Construction without container connection (ALL Iterators)
-        inline iterator_state(): container_(nullptr) {}
-
-        // Construction with connected container; (ALL Iterators)
-        inline iterator_state(container_type * container): container_(container) {
-            ++container_->IteratorConnectCount;
-        }
-
-
-        // Copy Construction from the changeble and const variants - allows changeble to const and vice versa assignment (ALL Iterators)
-        inline iterator_state(const iterator_state<true> & source): container_(source.container_), current_(source.current_) {}
-        inline iterator_state(const iterator_state<false> & source): container_(source.container_), current_(source.current_) {}
-
-        // Destruction (ALL Iterators)
-        inline ~iterator_state() {
-            current_ = internal_iterator();
-            if( container_ != nullptr)
-            { 
-                ++container_->IteratorDisconnectCount;
-                container_ = nullptr; 
-            }
-        }
-
-        // Start and End Positions (ALL Iterators)
-        inline void begin() {current_ = container_->InternalData.begin(); }
-        inline void end() {current_ = container_->InternalData.end(); }
-
-        // Availability and Equality (ALL Iterators)
-        inline bool is_connected() const { return container_ != nullptr; }
-        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
-        inline bool is_equal(const iterator_state<false> & other) const { return current_ == other.current_; }
-
-
-        // Move Next (ALL Iterators)
-        inline void next() { ++current_; }
-
-
-        // Element Access (ALL Iterators)
-        template<typename T = value_type>
-        inline typename std::enable_if<! is_const, T>::type & get() {return *current_; }
-
-        template<typename T = value_type>
-        inline typename std::enable_if<is_const, T>::type & get() const {return *current_; }
-    };
-
-    typedef custom_iterator_template<iterator_state, false> iterator;
-    typedef custom_iterator_template<iterator_state, true> const_iterator;
-
-
-    iterator begin() { return iterator::begin(this); }
-    iterator end() { return iterator::end(this); }
-
-    const_iterator begin() const { return const_iterator::begin(this); }
-    const_iterator end() const { return const_iterator::end(this); }
-
-    const_iterator cbegin() const { return const_iterator::begin(this); }
-    const_iterator cend() const { return const_iterator::end(this); }
-};
-
-// Skeleton for Bidirectional Iterators
-// https://en.cppreference.com/w/cpp/named_req/BidirectionalIterator
-struct CustomContainerWithBidirectionalIterator: public CustomContainerBase {
-
-    CustomContainerWithBidirectionalIterator() = default;
-    CustomContainerWithBidirectionalIterator(std::initializer_list<int> values): CustomContainerBase(values) {}
-
-
-    template<bool is_const>
-    struct iterator_state {
-
-        // Specifing the type of the specialized iterator - these typedefs are picked up by the template to define the iterators (ALL Iterators)
-        typedef std::bidirectional_iterator_tag iterator_category;
-        typedef typename std::conditional<is_const, const CustomContainerWithBidirectionalIterator, CustomContainerWithBidirectionalIterator>::type        container_type;
-        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type            value_type;
-        typedef typename std::conditional<is_const, decltype(InternalData)::const_iterator, decltype(InternalData)::iterator>::type internal_iterator;
-
-        container_type * container_;
-        internal_iterator current_;
-
-        // Default Construction without container connection (ALL Iterators)
-        inline iterator_state(): container_(nullptr) {}
-
-        // Construction with connected container; (ALL Iterators)
-        inline iterator_state(container_type * container): container_(container) {
-            ++container_->IteratorConnectCount;
-        }
-
-
-        // Copy Construction from the changeble and const variants - allows changeble to const and vice versa assignment (ALL Iterators)
-        inline iterator_state(const iterator_state<true> & source): container_(source.container_), current_(source.current_) {}
-        inline iterator_state(const iterator_state<false> & source): container_(source.container_), current_(source.current_) {}
-
-        // Destruction (ALL Iterators)
-        inline ~iterator_state() {
-            current_ = internal_iterator();
-            if( container_ != nullptr)
-            { 
-                ++container_->IteratorDisconnectCount;
-                container_ = nullptr; 
-            }
-        }
-
-        // Start and End Positions (ALL Iterators)
-        inline void begin() {current_ = container_->InternalData.begin(); }
-        inline void end() {current_ = container_->InternalData.end(); }
-
-        // Availability and Equality (ALL Iterators)
-        inline bool is_connected() const { return container_ != nullptr; }
-        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
-        inline bool is_equal(const iterator_state<false> & other) const { return current_ == other.current_; }
-
-
-        // Move Next (ALL Iterators)
-        inline void next() { ++current_; }
-
-
-        // Element Access (ALL Iterators)
-        template<typename T = value_type>
-        inline typename std::enable_if<! is_const, T>::type & get() {return *current_; }
-
-        template<typename T = value_type>
-        inline typename std::enable_if<is_const, T>::type & get() const {return *current_; }
-
-
-        // Move Previous (Bidirectional, Random Access Iterators)
-        inline void prev() { --current_; }
-    };
-
-    typedef custom_iterator_template<iterator_state, false> iterator;
-    typedef custom_iterator_template<iterator_state, true> const_iterator;
-    typedef std::reverse_iterator<iterator> reverse_iterator;
-    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
-
-
-    iterator begin() { return iterator::begin(this); }
-    iterator end() { return iterator::end(this); }
-
-    const_iterator begin() const { return const_iterator::begin(this); }
-    const_iterator end() const { return const_iterator::end(this); }
-
-    const_iterator cbegin() const { return const_iterator::begin(this); }
-    const_iterator cend() const { return const_iterator::end(this); }
-
-    reverse_iterator rbegin() { return reverse_iterator(end()); }
-    reverse_iterator rend() { return reverse_iterator(begin()); }
-
-    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
-    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
-};
-
-// Skeleton for Random Access Iterators
-struct CustomContainerWithRandomAccessIterator: public CustomContainerBase {
-
-    CustomContainerWithRandomAccessIterator() = default;
-    CustomContainerWithRandomAccessIterator(std::initializer_list<int> values): CustomContainerBase(values) {}
-
-
-    template<bool is_const>
-    struct iterator_state {
-
-        // Specifing the type of the specialized iterator - these typedefs are picked up by the template to define the iterators (ALL Iterators)
-        typedef std::random_access_iterator_tag iterator_category;
-        typedef typename std::conditional<is_const, const CustomContainerWithRandomAccessIterator, CustomContainerWithRandomAccessIterator>::type        container_type;
-        typedef typename std::conditional<is_const, const CustomElement, CustomElement>::type            value_type;
-        typedef typename std::conditional<is_const, decltype(InternalData)::const_iterator, decltype(InternalData)::iterator>::type internal_iterator;
-
-        container_type * container_;
-        internal_iterator current_;
-
-        // Default Construction without container connection (ALL Iterators)
-        inline iterator_state(): container_(nullptr) {}
-
-        // Construction with connected container; (ALL Iterators)
-        inline iterator_state(container_type * container): container_(container) {
-            ++container_->IteratorConnectCount;
-        }
-
-
-        // Copy Construction from the changeble and const variants - allows changeble to const and vice versa assignment (ALL Iterators)
-        inline iterator_state(const iterator_state<true> & source): container_(source.container_), current_(source.current_) {}
-        inline iterator_state(const iterator_state<false> & source): container_(source.container_), current_(source.current_) {}
-
-        // Destruction (ALL Iterators)
-        inline ~iterator_state() {
-            current_ = internal_iterator();
-            if( container_ != nullptr)
-            { 
-                ++container_->IteratorDisconnectCount;
-                container_ = nullptr; 
-            }
-        }
-
-        // Start and End Positions (ALL Iterators)
-        inline void begin() {current_ = container_->InternalData.begin(); }
-        inline void end() {current_ = container_->InternalData.end(); }
-
-        // Availability and Equality (ALL Iterators)
-        inline bool is_connected() const { return container_ != nullptr; }
-        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
-        inline bool is_equal(const iterator_state<false> & other) const { return current_ == other.current_; }
-
-
-        // Move Next (ALL Iterators)
-        inline void next() { ++current_; }
-
-
-        // Element Access (ALL Iterators)
-        template<typename T = value_type>
-        inline typename std::enable_if<! is_const, T>::type & get() {return *current_; }
-
-        template<typename T = value_type>
-        inline typename std::enable_if<is_const, T>::type & get() const {return *current_; }
-
-
-        // Move Previous (Bidirectional, Random Access Iterators)
-        inline void prev() { --current_; }
-
-        // Move to position (Random Access Iterators)
-        inline void move(std::ptrdiff_t offset) { current_ += offset; }
-
-        // Calculate Distance (Random Access Iterators)
-        inline std::ptrdiff_t distance(const iterator_state<true> & rhs) const { return current_ - rhs.current_; }
-        inline std::ptrdiff_t distance(const iterator_state<false> & rhs) const { return current_ - rhs.current_; }
-
-
-        // Element access at position (Random Access Iterators)
-        template<typename T = value_type>
-        inline typename std::enable_if<! is_const, T>::type & at(std::ptrdiff_t offset) {return current_[offset]; }
-
-        template<typename T = std::ptrdiff_t>
-        inline value_type & at(typename std::enable_if<is_const, T>::type offset) const {return current_[offset]; }
-    };
-
-    typedef custom_iterator_template<iterator_state, false> iterator;
-    typedef custom_iterator_template<iterator_state, true> const_iterator;
-    typedef std::reverse_iterator<iterator> reverse_iterator;
-    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
-
-
-    iterator begin() { return iterator::begin(this); }
-    iterator end() { return iterator::end(this); }
-
-    const_iterator begin() const { return const_iterator::begin(this); }
-    const_iterator end() const { return const_iterator::end(this); }
-
-    const_iterator cbegin() const { return const_iterator::begin(this); }
-    const_iterator cend() const { return const_iterator::end(this); }
-
-    reverse_iterator rbegin() { return reverse_iterator(end()); }
-    reverse_iterator rend() { return reverse_iterator(begin()); }
-
-    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
-    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
-};
-
 // ****************************** Iterator Concept Test *********************************************
 // https://en.cppreference.com/w/cpp/named_req/Iterator
 // https://en.cppreference.com/w/cpp/experimental/ranges/iterator/Readable
@@ -817,6 +414,175 @@ TEST(IteratorTemplate, TestChangebleToConstCast) {
     EXPECT_EQ(*constIterator, CustomElement{1});
 }
 
+TEST(IteratorTemplate, TestTriviallyCopyableIterators) {
+    // Triviality is propagated from trivially copyable states
+    static_assert(std::is_trivially_copyable<CustomContainerWithTrivialIteratorState::iterator>::value, "Iterators of trivially copyable states must be trivially copyable");
+    static_assert(std::is_trivially_copyable<CustomContainerWithTrivialIteratorState::const_iterator>::value, "Iterators of trivially copyable states must be trivially copyable");
+    static_assert(std::is_trivially_copy_constructible<CustomContainerWithTrivialIteratorState::iterator>::value, "Iterators of trivially copyable states must be trivially copy constructible");
+    static_assert(std::is_trivially_move_constructible<CustomContainerWithTrivialIteratorState::iterator>::value, "Iterators of trivially copyable states must be trivially move constructible");
+    static_assert(std::is_trivially_copy_assignable<CustomContainerWithTrivialIteratorState::iterator>::value, "Iterators of trivially copyable states must be trivially copy assignable");
+    static_assert(std::is_trivially_move_assignable<CustomContainerWithTrivialIteratorState::iterator>::value, "Iterators of trivially copyable states must be trivially move assignable");
+    static_assert(std::is_trivially_destructible<CustomContainerWithTrivialIteratorState::iterator>::value, "Iterators of trivially copyable states must be trivially destructible");
+
+    // States with copy and destruction side effects keep them
+    static_assert(! std::is_trivially_copyable<CustomContainerWithRandomAccessIterator::iterator>::value, "Iterators of non trivial states must not be trivially copyable");
+    static_assert(! std::is_trivially_destructible<CustomContainerWithRandomAccessIterator::iterator>::value, "Iterators of non trivial states must not be trivially destructible");
+
+    CustomContainerWithTrivialIteratorState container{1, 2};
+    CustomContainerWithTrivialIteratorState::iterator iterator = container.begin();
+    CustomContainerWithTrivialIteratorState::iterator copiedIterator = iterator;
+    CustomContainerWithTrivialIteratorState::const_iterator constIterator = ++copiedIterator;
+
+    EXPECT_EQ(*iterator, CustomElement{1});
+    EXPECT_EQ(*copiedIterator, CustomElement{2});
+    EXPECT_EQ(*constIterator, CustomElement{2});
+    EXPECT_FALSE(CustomContainerWithTrivialIteratorState::iterator().is_connected());
+}
+
+TEST(IteratorTemplate, TestUnconnectedComparisonWithoutConnectionChecks) {
+    CustomContainerWithTrivialIteratorState container{1, 2};
+
+    EXPECT_TRUE(CustomContainerWithTrivialIteratorState::iterator() == CustomContainerWithTrivialIteratorState::iterator());
+    EXPECT_TRUE(CustomContainerWithTrivialIteratorState::const_iterator() == CustomContainerWithTrivialIteratorState::iterator());
+    EXPECT_FALSE(CustomContainerWithTrivialIteratorState::iterator() == container.begin());
+    EXPECT_FALSE(container.cbegin() == CustomContainerWithTrivialIteratorState::iterator());
+    EXPECT_TRUE(container.begin() == container.cbegin());
+    EXPECT_TRUE(container.begin() != container.end());
+}
+
+typedef tmc::foundation::custom_iterator_template<CustomContainerWithPointerIteratorState::iterator_state, false, tmc::foundation::unchecked_iterator_policy> UncheckedPointerIterator;
+typedef tmc::foundation::custom_iterator_template<CustomContainerWithPointerIteratorState::iterator_state, true, tmc::foundation::unchecked_iterator_policy> UncheckedPointerConstIterator;
+typedef tmc::foundation::custom_iterator_template<CustomContainerWithPointerIteratorState::iterator_state, false, tmc::foundation::checked_iterator_policy> CheckedPointerIterator;
+
+TEST(IteratorTemplate, TestPointerBackedStatesCollapseInUncheckedIterators) {
+    static_assert(sizeof(UncheckedPointerIterator) == sizeof(CustomElement *), "Unchecked iterators of pointer backed states are element pointers");
+    static_assert(sizeof(CheckedPointerIterator) == sizeof(CustomContainerWithPointerIteratorState::iterator_state<false>), "Checked iterators keep the full state");
+    static_assert(std::is_trivially_copyable<UncheckedPointerIterator>::value, "Collapsed iterators are trivially copyable");
+#if !TMC_CUSTOM_ITERATOR_CHECKED
+    static_assert(sizeof(CustomContainerWithPointerIteratorState::iterator) == sizeof(CustomElement *), "Release iterators of pointer backed states are element pointers");
+#endif
+
+    CustomContainerWithPointerIteratorState container{3, 1, 2};
+    auto first = UncheckedPointerIterator::begin(&container);
+    const auto last = UncheckedPointerIterator::end(&container);
+
+    EXPECT_EQ(last - first, 3);
+    EXPECT_EQ(&*first, container.InternalData.data());
+    std::sort(first, last, [](const CustomElement &lhs, const CustomElement &rhs) { return lhs.GetValue() < rhs.GetValue(); });
+    EXPECT_EQ(container.InternalData, std::vector<CustomElement>({CustomElement(1), CustomElement(2), CustomElement(3)}));
+
+    UncheckedPointerConstIterator constIterator = first + 1;
+    EXPECT_EQ(*constIterator, CustomElement(2));
+    EXPECT_EQ(constIterator[1], CustomElement(3));
+    EXPECT_TRUE(constIterator == first + 1);
+    EXPECT_EQ(*std::reverse_iterator<UncheckedPointerIterator>(last), CustomElement(3));
+    EXPECT_FALSE(UncheckedPointerIterator().is_connected());
+    EXPECT_TRUE(UncheckedPointerIterator() == UncheckedPointerIterator());
+
+    // The checked iterators of the same state
+    EXPECT_EQ(CheckedPointerIterator::end(&container) - CheckedPointerIterator::begin(&container), 3);
+    EXPECT_EQ(std::vector<CustomElement>(container.rbegin(), container.rend()), std::vector<CustomElement>({CustomElement(3), CustomElement(2), CustomElement(1)}));
+}
+
+// A collapsing pointer backed state that also implements `is_end()` (and `next_chunk()` in C++20): the element pointer
+// has neither hook, unchecked iterators keep the state
+template<bool is_const>
+struct EndTestingPointerState: CustomContainerWithPointerIteratorState::iterator_state<is_const> {
+    typedef CustomContainerWithPointerIteratorState::iterator_state<is_const> base_type;
+    using base_type::base_type;
+
+    template<bool other_is_const, typename std::enable_if<is_const && !other_is_const, int>::type = 0>
+    inline EndTestingPointerState(const EndTestingPointerState<other_is_const> & source): base_type(source) {}
+
+    inline typename base_type::value_type * address() const { return this->current_; }
+    inline bool is_end() const { return this->current_ == this->container_->InternalData.data() + this->container_->InternalData.size(); }
+
+#if __cplusplus >= 202002L
+    inline std::span<typename base_type::value_type> next_chunk(std::ptrdiff_t max) {
+        const std::ptrdiff_t remaining = this->container_->InternalData.data() + this->container_->InternalData.size() - this->current_;
+        std::span<typename base_type::value_type> chunk(this->current_, static_cast<std::size_t>(remaining < max ? remaining : max));
+        this->current_ += chunk.size();
+        return chunk;
+    }
+#endif
+};
+
+typedef tmc::foundation::custom_iterator_template<EndTestingPointerState, false, tmc::foundation::unchecked_iterator_policy> UncheckedEndTestingPointerIterator;
+
+TEST(IteratorTemplate, TestPointerBackedStatesWithEndTestsDoNotCollapse) {
+    static_assert(sizeof(UncheckedEndTestingPointerIterator) == sizeof(EndTestingPointerState<false>), "Unchecked iterators of states implementing is_end() keep the state");
+
+    CustomContainerWithPointerIteratorState container{1, 2, 3};
+    auto iterator = UncheckedEndTestingPointerIterator::begin(&container);
+    EXPECT_TRUE(iterator != tmc::foundation::custom_iterator_sentinel{});
+    iterator += 3;
+    EXPECT_TRUE(iterator == tmc::foundation::custom_iterator_sentinel{});
+#if __cplusplus >= 202002L
+    auto first = UncheckedEndTestingPointerIterator::begin(&container);
+    EXPECT_EQ(first.next_chunk(tmc::foundation::custom_iterator_sentinel{}, 2).size(), 2u);
+    EXPECT_EQ(*first, CustomElement(3));
+#endif
+}
+
+// Constant evaluation: iteration, element writes and random access over a literal container
+static constexpr CustomConstexprArray<5> ConstexprValues{{1, 2, 3, 4, 5}};
+
+constexpr int ConstexprSum(const CustomConstexprArray<5> & values) {
+    int sum = 0;
+    for (int value: values) {
+        sum += value;
+    }
+    return sum;
+}
+
+constexpr CustomConstexprArray<8> ConstexprSquares() {
+    CustomConstexprArray<8> squares{};
+    int index = 0;
+    for (int &square: squares) {
+        square = index * index;
+        ++index;
+    }
+    return squares;
+}
+
+constexpr int ConstexprReverseFirst(const CustomConstexprArray<5> & values) {
+    return *values.rbegin();
+}
+
+constexpr bool ConstexprRandomAccess(const CustomConstexprArray<5> & values) {
+    auto first = values.begin();
+    const auto last = values.end();
+    CustomConstexprArray<5>::const_iterator middle = first + 2;
+    return last - first == 5 && *middle == 3 && middle[2] == 5 && first < middle && *--middle == 2 && (middle += 2) != last;
+}
+
+static_assert(ConstexprSum(ConstexprValues) == 15, "Range for loops run in constant expressions");
+static_assert(ConstexprSquares().elements_[7] == 49, "Element writes run in constant expressions");
+static_assert(ConstexprReverseFirst(ConstexprValues) == 5, "Reverse iterators run in constant expressions");
+static_assert(ConstexprRandomAccess(ConstexprValues), "Random access operations run in constant expressions");
+static_assert(*ConstexprValues.cbegin() == 1, "Iterators of constexpr containers are constant expressions");
+
+TEST(IteratorTemplate, TestConstexprContainerAtRuntime) {
+    CustomConstexprArray<8> squares = ConstexprSquares();
+    EXPECT_EQ(std::vector<int>(squares.begin(), squares.end()), std::vector<int>({0, 1, 4, 9, 16, 25, 36, 49}));
+    EXPECT_EQ(ConstexprSum(ConstexprValues), 15);
+}
+
+// The accessors of the SETUP_* defines are plain member functions, the constexpr ones too: no template argument list
+TEST(IteratorTemplate, TestAccessorMemberPointers) {
+    typedef CustomContainerWithNativeReverseIterator Container;
+    Container container{1, 2, 3};
+
+    Container::iterator (Container::*begin)() = &Container::begin;
+    auto cend = std::mem_fn(&Container::cend);
+
+    EXPECT_EQ((container.*begin)()->GetValue(), 1);
+    EXPECT_EQ(cend(container) - (container.*begin)(), 3);
+
+    auto constexprCbegin = std::mem_fn(&CustomConstexprArray<5>::cbegin);
+    EXPECT_EQ(*constexprCbegin(ConstexprValues), 1);
+}
+
 TEST(IteratorTemplate, TestChangebleAndConstComparison) {
     CustomContainerWithRandomAccessIterator container{1, 2};
 
@@ -926,6 +692,71 @@ TEST(IteratorTemplate, TestReverseIteratorLoops) {
     EXPECT_THAT(constTwoElementsContent, ::testing::ContainerEq(std::vector<int>({2,1})));
 }
 
+TEST(IteratorTemplate, TestNativeReverseIteratorLoops) {
+    static_assert(!std::is_same<CustomContainerWithNativeReverseIterator::reverse_iterator, std::reverse_iterator<CustomContainerWithNativeReverseIterator::iterator>>::value, "States implementing rbegin() / rend() must produce native reverse iterators");
+    static_assert(std::is_same<CustomContainerWithRandomAccessIterator::reverse_iterator, std::reverse_iterator<CustomContainerWithRandomAccessIterator::iterator>>::value, "States without rbegin() / rend() must produce std::reverse_iterator");
+    static_assert(std::is_same<std::iterator_traits<CustomContainerWithNativeReverseIterator::reverse_iterator>::iterator_category, std::random_access_iterator_tag>::value, "Native reverse iterators must keep the iterator category");
+
+    CustomContainerWithNativeReverseIterator empty{};
+    CustomContainerWithNativeReverseIterator threeElements{1,2,3};
+    const auto &constThreeElementsRef = threeElements;
+
+    size_t emptyCount = 0u;
+    for (auto i = empty.rbegin(), end = empty.rend(); i != end; ++i) {
+        ++emptyCount;
+    }
+
+    std::vector<int> threeElementsContent;
+    for (auto i = threeElements.rbegin(), end = threeElements.rend(); i != end; ++i) {
+        static_assert(! std::is_const< std::remove_reference<decltype(*i)>::type>::value, "Iterators must introduce changeable Elements");
+        threeElementsContent.push_back(i->GetValue());
+        i->SetValue(i->GetValue());
+    }
+
+    std::vector<int> constThreeElementsContent;
+    for (auto i = constThreeElementsRef.rbegin(), end = constThreeElementsRef.rend(); i != end; ++i) {
+        static_assert(std::is_const< std::remove_reference<decltype(*i)>::type>::value, "Const iterators must introduce const Elements");
+        constThreeElementsContent.push_back(i->GetValue());
+    }
+
+    EXPECT_EQ(emptyCount, 0u);
+    EXPECT_THAT(threeElementsContent, ::testing::ContainerEq(std::vector<int>({3,2,1})));
+    EXPECT_THAT(constThreeElementsContent, ::testing::ContainerEq(std::vector<int>({3,2,1})));
+}
+
+TEST(IteratorTemplate, TestNativeReverseIteratorRandomAccess) {
+    CustomContainerWithNativeReverseIterator container{1,2,3,4};
+
+    auto first = container.rbegin();
+    const auto last = container.rend();
+    CustomContainerWithNativeReverseIterator::const_reverse_iterator constFirst = first;
+
+    EXPECT_EQ(last - first, 4);
+    EXPECT_EQ(first - last, -4);
+    EXPECT_EQ((first + 1)->GetValue(), 3);
+    EXPECT_EQ(first[3].GetValue(), 1);
+    EXPECT_EQ((last - 1)->GetValue(), 1);
+    EXPECT_TRUE(first < last);
+    EXPECT_TRUE(constFirst == first);
+    EXPECT_EQ(std::find(first, last, CustomElement(2)) - first, 2);
+
+    std::sort(container.rbegin(), container.rend(), [](const CustomElement &lhs, const CustomElement &rhs) { return lhs.GetValue() < rhs.GetValue(); });
+    EXPECT_THAT(container.InternalData, ::testing::ElementsAre(CustomElement(4), CustomElement(3), CustomElement(2), CustomElement(1)));
+}
+
+TEST(IteratorTemplate, TestNativeReverseIteratorsDoNotCopyOnAccess) {
+    CustomContainerWithNativeReverseIterator container{1,2,3,4,5,6,7,8};
+
+    int sum = 0;
+    for (auto i = container.rbegin(), end = container.rend(); i != end; ++i) {
+        sum += i->GetValue();
+    }
+
+    EXPECT_EQ(sum, 36);
+    EXPECT_EQ(container.IteratorConnectCount, 2u);
+    EXPECT_EQ(container.IteratorDisconnectCount, 2u);
+}
+
 TEST(IteratorTemplate, TestRangeBasedLoops) {
     CustomContainerWithRandomAccessIterator empty {};
     CustomContainerWithRandomAccessIterator twoElements{1,2};
@@ -970,6 +801,109 @@ TEST(IteratorTemplate, TestRangeBasedLoops) {
     EXPECT_THAT(constTwoElementsContent, ::testing::ContainerEq(std::vector<int>({1,2})));
 }
 
+// Null terminated character source - the end is detected while iterating instead of being computed up front
+struct NullTerminatedCharacters {
+    NullTerminatedCharacters(const char *text): text_(text) {}
+
+    template<bool is_const>
+    struct iterator_state {
+        typedef std::forward_iterator_tag iterator_category;
+        typedef const NullTerminatedCharacters container_type;
+        typedef const char value_type;
+
+        const char * current_{nullptr};
+
+        inline iterator_state() = default;
+        inline iterator_state(container_type * container): current_(container->text_) {}
+
+        inline void begin() {}
+        inline bool is_end() const { return *current_ == '\0'; }
+
+        inline bool is_connected() const { return current_ != nullptr; }
+        inline bool is_equal(const iterator_state<true> & other) const { return current_ == other.current_; }
+
+        inline void next() { ++current_; }
+        inline value_type & get() const { return *current_; }
+    };
+
+    SETUP_CONST_ITERATOR(iterator_state);
+
+    const_iterator begin() const { return cbegin(); }
+    const_iterator::sentinel_type end() const { return cend(); }
+
+private:
+    const char * text_;
+};
+
+TEST(IteratorTemplate, TestSentinelTypes) {
+    CustomContainerWithSentinel container{1,2};
+
+    EXPECT_EQ(typeid(decltype(container.end())), typeid(custom_iterator_sentinel));
+    EXPECT_EQ(typeid(decltype(container.cend())), typeid(custom_iterator_sentinel));
+    EXPECT_EQ(typeid(CustomContainerWithSentinel::iterator::sentinel_type), typeid(custom_iterator_sentinel));
+    EXPECT_EQ(typeid(CustomContainerWithRandomAccessIterator::iterator::sentinel_type), typeid(CustomContainerWithRandomAccessIterator::iterator));
+}
+
+TEST(IteratorTemplate, TestSentinelLoops) {
+    CustomContainerWithSentinel empty{};
+    CustomContainerWithSentinel twoElements{1,2};
+
+    EXPECT_TRUE(empty.begin() == empty.end());
+    EXPECT_TRUE(empty.end() == empty.begin());
+    EXPECT_FALSE(twoElements.begin() == twoElements.end());
+    EXPECT_TRUE(twoElements.end() != twoElements.begin());
+
+    std::vector<int> twoElementsContent;
+    for (auto i = twoElements.begin(); i != twoElements.end(); ++i) {
+        twoElementsContent.push_back(i->GetValue());
+    }
+
+    std::vector<int> rangeBasedContent;
+    for (auto & elem: twoElements) {
+        static_assert(! std::is_const< std::remove_reference<decltype(elem)>::type>::value, "Iterators must introduce changeable Elements");
+        rangeBasedContent.push_back(elem.GetValue());
+    }
+
+    std::vector<int> constContent;
+    for (auto i = twoElements.cbegin(); i != twoElements.cend(); ++i) {
+        constContent.push_back(i->GetValue());
+    }
+
+    EXPECT_THAT(twoElementsContent, ::testing::ContainerEq(std::vector<int>({1,2})));
+    EXPECT_THAT(rangeBasedContent, ::testing::ContainerEq(std::vector<int>({1,2})));
+    EXPECT_THAT(constContent, ::testing::ContainerEq(std::vector<int>({1,2})));
+}
+
+TEST(IteratorTemplate, TestSentinelDoesNotConnectEndIterators) {
+    CustomContainerWithSentinel container{1,2,3};
+
+    size_t count = 0u;
+    for ([[maybe_unused]] auto & elem: container) {
+        ++count;
+    }
+
+    EXPECT_EQ(count, 3u);
+    EXPECT_EQ(container.IteratorConnectCount, 1u);
+}
+
+TEST(IteratorTemplate, TestSentinelForNullTerminatedSource) {
+    NullTerminatedCharacters empty{""};
+    NullTerminatedCharacters text{"abc"};
+
+    std::string emptyContent;
+    for (char character: empty) {
+        emptyContent.push_back(character);
+    }
+
+    std::string textContent;
+    for (char character: text) {
+        textContent.push_back(character);
+    }
+
+    EXPECT_EQ(emptyContent, "");
+    EXPECT_EQ(textContent, "abc");
+}
+
 TEST(IteratorTemplate, TestPartialStateForInputIterator) {
     CustomContainerWithInputIterator container{1,2};
     const CustomContainerWithInputIterator constContainer{1,2};
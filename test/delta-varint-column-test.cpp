@@ -0,0 +1,174 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/delta-varint-column.hpp>
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+// Small blocks to cross many block boundaries
+typedef delta_varint_column<4> SmallBlockColumn;
+
+static_assert(std::is_same<SmallBlockColumn::const_iterator::iterator_category, std::forward_iterator_tag>::value, "Compressed columns must have forward iterators");
+static_assert(std::is_same<SmallBlockColumn::const_iterator::reference, std::uint64_t>::value, "Decoded values must be returned by value");
+static_assert(sizeof(delta_varint_column<>::const_iterator) == sizeof(delta_varint_column<4096>::const_iterator), "The iterator buffer must not grow with the block size");
+
+#if __cplusplus >= 202002L
+static_assert(std::forward_iterator<SmallBlockColumn::iterator> && std::forward_iterator<SmallBlockColumn::const_iterator>, "Compressed column iterators must be forward iterators");
+#endif
+
+// Sorted values with duplicates across block boundaries and one to ten byte deltas
+static std::vector<std::uint64_t> MakeSortedValues() {
+    return {0, 0, 1, 5, 5, 5, 5, 5, 127, 128, 300, 16384, 16384, 1ull << 35, (1ull << 35) + 1, 1ull << 56, 1ull << 63, ~std::uint64_t{0}, ~std::uint64_t{0}};
+}
+
+TEST(DeltaVarintColumn, TestIteration) {
+    const std::vector<std::uint64_t> values = MakeSortedValues();
+    SmallBlockColumn column(values.begin(), values.end());
+    const SmallBlockColumn &constColumn = column;
+
+    EXPECT_EQ(column.size(), values.size());
+    EXPECT_EQ(column.block_count(), 5u);
+    EXPECT_THAT(std::vector<std::uint64_t>(column.begin(), column.end()), ElementsAreArray(values));
+    EXPECT_THAT(std::vector<std::uint64_t>(constColumn.begin(), constColumn.end()), ElementsAreArray(values));
+    EXPECT_EQ(std::distance(column.cbegin(), column.cend()), static_cast<std::ptrdiff_t>(values.size()));
+
+    SmallBlockColumn::const_iterator converted = column.begin();
+    std::advance(converted, 6);
+    EXPECT_EQ(*converted, 5u);
+    EXPECT_TRUE(std::next(converted, 13) == column.cend());
+}
+
+TEST(DeltaVarintColumn, TestEmptyColumn) {
+    delta_varint_column<> column;
+
+    EXPECT_TRUE(column.empty());
+    EXPECT_TRUE(column.begin() == column.end());
+    EXPECT_TRUE(column.lower_bound(0) == column.cend());
+    EXPECT_EQ(column.size_bytes(), 0u);
+}
+
+TEST(DeltaVarintColumn, TestCompression) {
+    delta_varint_column<> column;
+    for (std::uint64_t id = 1000000; id < 1000000 + 3 * 1000; id += 3) {
+        column.push_back(id);
+    }
+
+    // 8 blocks: 8 uncompressed first values in the block table, 992 one byte deltas
+    EXPECT_EQ(column.block_count(), 8u);
+    EXPECT_EQ(column.size_bytes(), 992u + 8 * sizeof(delta_varint_column<>::block_header));
+    EXPECT_EQ(column.blocks()[1].first, 1000000u + 3 * 128);
+}
+
+TEST(DeltaVarintColumn, TestMixedDeltaLengths) {
+    // Runs of one byte deltas (decoded eight at once) interrupted by longer deltas, partial last block
+    std::vector<std::uint64_t> values;
+    std::uint64_t value = 0;
+    for (std::size_t index = 0; index < 1000; ++index) {
+        value += index % 37 == 0 ? (std::uint64_t{1} << (index % 50)) : index % 100;
+        values.push_back(value);
+    }
+    const delta_varint_column<> column(values.begin(), values.end());
+
+    EXPECT_THAT(std::vector<std::uint64_t>(column.begin(), column.end()), ElementsAreArray(values));
+
+    // Seeks into later chunks of the blocks, from the start and forward from the previous result
+    auto from = column.cbegin();
+    for (std::size_t index = 0; index < values.size(); index += 23) {
+        SCOPED_TRACE(index);
+        const auto expected = std::lower_bound(values.begin(), values.end(), values[index]);
+        const auto found = column.lower_bound(values[index]);
+        from = column.lower_bound(from, values[index]);
+        EXPECT_EQ(std::distance(column.cbegin(), found), std::distance(values.begin(), expected));
+        EXPECT_TRUE(from == found);
+        EXPECT_EQ(*found, values[index]);
+    }
+    EXPECT_EQ(*column.lower_bound(values[700] - 1), values[700]);
+}
+
+TEST(DeltaVarintColumn, TestUnsortedValuesThrow) {
+    SmallBlockColumn column{1, 2, 3};
+
+    EXPECT_THROW(column.push_back(2), std::invalid_argument);
+    column.push_back(3);
+    EXPECT_THAT(std::vector<std::uint64_t>(column.begin(), column.end()), ElementsAre(1, 2, 3, 3));
+}
+
+TEST(DeltaVarintColumn, TestLowerBound) {
+    const std::vector<std::uint64_t> values = MakeSortedValues();
+    const SmallBlockColumn column(values.begin(), values.end());
+
+    std::vector<std::uint64_t> searched{2, 6, 126, 129, 16383, 16385, (1ull << 56) - 1, ~std::uint64_t{0} - 1};
+    searched.insert(searched.end(), values.begin(), values.end());
+    for (std::uint64_t value: searched) {
+        SCOPED_TRACE(value);
+        const auto expected = std::lower_bound(values.begin(), values.end(), value);
+        const auto found = column.lower_bound(value);
+        EXPECT_EQ(std::distance(column.cbegin(), found), std::distance(values.begin(), expected));
+        EXPECT_EQ(*found, *expected);
+        EXPECT_THAT(std::vector<std::uint64_t>(found, column.cend()), ElementsAreArray(expected, values.end()));
+    }
+
+    const SmallBlockColumn small{10, 20, 30, 40, 50};
+    EXPECT_TRUE(small.lower_bound(51) == small.cend());
+    EXPECT_TRUE(small.lower_bound(0) == small.cbegin());
+}
+
+TEST(DeltaVarintColumn, TestForwardSeekIntersection) {
+    std::vector<std::uint64_t> multiplesOf3;
+    std::vector<std::uint64_t> multiplesOf7;
+    for (std::uint64_t value = 0; value < 1000; value += 3) {
+        multiplesOf3.push_back(value);
+    }
+    for (std::uint64_t value = 0; value < 1000; value += 7) {
+        multiplesOf7.push_back(value);
+    }
+    const SmallBlockColumn threes(multiplesOf3.begin(), multiplesOf3.end());
+    const SmallBlockColumn sevens(multiplesOf7.begin(), multiplesOf7.end());
+
+    // Leapfrog intersection: each side seeks to the current value of the other side
+    std::vector<std::uint64_t> intersection;
+    auto three = threes.cbegin();
+    auto seven = sevens.cbegin();
+    while (three != threes.cend() && seven != sevens.cend()) {
+        if (*three == *seven) {
+            intersection.push_back(*three);
+            ++three;
+        } else if (*three < *seven) {
+            three = threes.lower_bound(three, *seven);
+        } else {
+            seven = sevens.lower_bound(seven, *three);
+        }
+    }
+
+    std::vector<std::uint64_t> expected;
+    std::set_intersection(multiplesOf3.begin(), multiplesOf3.end(), multiplesOf7.begin(), multiplesOf7.end(), std::back_inserter(expected));
+    EXPECT_THAT(intersection, ElementsAreArray(expected));
+    EXPECT_TRUE(threes.lower_bound(threes.cend(), 5) == threes.cend());
+}
+
+TEST(DeltaVarintColumn, TestAppendsAdvanceTheGeneration) {
+    SmallBlockColumn column{1, 2, 3};
+    const auto generation = [&column]() { return custom_iterator_access::state(column.cbegin()).generation(); };
+    const std::size_t initial = generation();
+
+    // The deltas of the new values may move the bytes the iterator states decode from
+    column.push_back(1000);
+    EXPECT_EQ(generation(), initial + 1);
+    column.shrink_to_fit();
+    EXPECT_EQ(generation(), initial + 2);
+    EXPECT_EQ(*column.lower_bound(4), 1000u);
+    column.clear();
+    EXPECT_EQ(generation(), initial + 3);
+}
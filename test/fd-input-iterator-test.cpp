@@ -0,0 +1,146 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/fd-input-iterator.hpp>
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+struct InputRecord {
+    int32_t key;
+    int32_t value;
+    int32_t flags;
+};
+
+static_assert(std::is_same<std::iterator_traits<fd_input_range<char, 16>::iterator>::iterator_category, std::input_iterator_tag>::value, "fd input iterators must be input iterators");
+static_assert(sizeof(fd_input_range<char, 16>::iterator) == sizeof(void *), "fd input iterators must not copy the buffer");
+static_assert(std::is_trivially_copyable<fd_input_range<char>::iterator>::value, "fd input iterators must be trivially copyable");
+
+// Pipe filled by a writer thread in pieces of `pieceSize` bytes, closed at the end
+struct InputPipe {
+    int fds[2];
+    std::thread writer;
+
+    InputPipe(std::string data, std::size_t pieceSize) {
+        EXPECT_EQ(::pipe(fds), 0);
+        writer = std::thread([this, data = std::move(data), pieceSize] {
+            for (std::size_t offset = 0; offset < data.size(); offset += pieceSize) {
+                const std::size_t count = std::min(pieceSize, data.size() - offset);
+                EXPECT_EQ(::write(fds[1], data.data() + offset, count), static_cast<ssize_t>(count));
+            }
+            ::close(fds[1]);
+        });
+    }
+
+    ~InputPipe() {
+        writer.join();
+        ::close(fds[0]);
+    }
+
+    int fd() const { return fds[0]; }
+};
+
+static std::string RecordBytes(const std::vector<InputRecord> &records) {
+    return std::string(reinterpret_cast<const char *>(records.data()), records.size() * sizeof(InputRecord));
+}
+
+TEST(FdInputIterator, TestReadsCharacters) {
+    InputPipe pipe("Hello, buffered world!", 5);
+    fd_input_range<char, 8> input(pipe.fd());
+
+    EXPECT_EQ(std::string(input.begin(), input.end()), "Hello, buffered world!");
+    EXPECT_EQ(input.begin(), input.end());
+}
+
+TEST(FdInputIterator, TestRuntimeBufferSize) {
+    InputPipe pipe(std::string(1000, 'x'), 1000);
+    fd_input_range<char> input(pipe.fd(), 100);
+
+    EXPECT_EQ(input.buffer_size(), 100u);
+    EXPECT_EQ(std::count(input.begin(), input.end(), 'x'), 1000);
+    EXPECT_GE(input.read_count(), 10u);
+    EXPECT_THROW(fd_input_range<InputRecord>(pipe.fd(), sizeof(InputRecord) - 1), std::invalid_argument);
+}
+
+TEST(FdInputIterator, TestCompletesRecordsSplitByReads) {
+    std::vector<InputRecord> records;
+    for (int32_t index = 0; index < 100; ++index) {
+        records.push_back(InputRecord{index, index * 2, 0});
+    }
+    // Pieces of 7 bytes and a buffer of 16 bytes split nearly every record
+    InputPipe pipe(RecordBytes(records) + "xyz", 7);
+    fd_input_range<InputRecord, 16> input(pipe.fd());
+
+    int32_t count = 0;
+    int64_t sum = 0;
+    for (const InputRecord &record: input) {
+        EXPECT_EQ(record.key, count);
+        sum += record.value;
+        ++count;
+    }
+
+    EXPECT_EQ(count, 100);
+    EXPECT_EQ(sum, 9900);
+}
+
+TEST(FdInputIterator, TestCopiesSharePosition) {
+    InputPipe pipe("abcdef", 6);
+    fd_input_range<char, 4> input(pipe.fd());
+
+    auto it = input.begin();
+    auto copy = it;
+    EXPECT_EQ(*it, 'a');
+    ++copy;
+    EXPECT_EQ(*it, 'b');
+
+    // Post-increment returns the old element, not an iterator copy
+    EXPECT_EQ(*it++, 'b');
+    EXPECT_EQ(*it, 'c');
+    const auto old = it++;
+    EXPECT_EQ(*old, 'c');
+    EXPECT_EQ(std::string(it, input.end()), "def");
+}
+
+TEST(FdInputIterator, TestEmptyInputAndDefaultIterator) {
+    InputPipe pipe("", 1);
+    typedef fd_input_range<int, 64> IntInput;
+    IntInput input(pipe.fd());
+
+    EXPECT_EQ(input.begin(), input.end());
+    EXPECT_EQ(input.begin(), IntInput::iterator());
+}
+
+TEST(FdInputIterator, TestReadErrorThrows) {
+    fd_input_range<char, 16> input(-1);
+
+    EXPECT_THROW(static_cast<void>(input.begin() == input.end()), std::system_error);
+}
+
+#if __cplusplus >= 202002L
+TEST(FdInputIterator, TestChunkedAccess) {
+    InputPipe pipe(std::string(100, 'y'), 100);
+    fd_input_range<char, 32> input(pipe.fd());
+
+    auto it = input.begin();
+    std::size_t total = 0;
+    for (auto chunk = it.next_chunk(input.end(), 1000); !chunk.empty(); chunk = it.next_chunk(input.end(), 1000)) {
+        EXPECT_LE(chunk.size(), 32u);
+        total += static_cast<std::size_t>(std::count(chunk.begin(), chunk.end(), 'y'));
+    }
+
+    EXPECT_EQ(total, 100u);
+}
+#endif
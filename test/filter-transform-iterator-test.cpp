@@ -0,0 +1,178 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/filter-transform-iterator.hpp>
+#include "custom-container-skeletons.hpp"
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+struct IsEven {
+    bool operator()(const CustomElement &element) const { return element.GetValue() % 2 == 0; }
+};
+
+struct TimesTen {
+    int operator()(const CustomElement &element) const { return element.GetValue() * 10; }
+};
+
+struct Below50 {
+    bool operator()(int value) const { return value < 50; }
+};
+
+typedef decltype(make_filter_range(std::declval<CustomContainerWithTrivialIteratorState &>(), IsEven{})) FilterRange;
+typedef decltype(make_transform_range(std::declval<CustomContainerWithTrivialIteratorState &>(), TimesTen{})) TransformRange;
+typedef decltype(make_transform_range(std::declval<const CustomContainerWithTrivialIteratorState &>(), TimesTen{})) ConstTransformRange;
+typedef decltype(make_filter_range(make_transform_range(std::declval<FilterRange &>(), TimesTen{}), Below50{})) StackedRange;
+
+static_assert(std::is_same<FilterRange::iterator::iterator_category, std::forward_iterator_tag>::value, "Filters must produce forward iterators");
+static_assert(std::is_same<TransformRange::iterator::iterator_category, std::random_access_iterator_tag>::value, "Transforms must keep the source category");
+static_assert(std::is_same<decltype(make_transform_range(std::declval<CustomContainerWithInputIterator &>(), TimesTen{}))::iterator::iterator_category, std::input_iterator_tag>::value, "Transforms must keep the source category");
+static_assert(std::is_same<FilterRange::iterator::reference, CustomElement &>::value, "Filters must pass the element references through");
+static_assert(std::is_same<TransformRange::iterator::reference, int>::value, "Transforms must return their results");
+static_assert(std::is_same<StackedRange::stages_type, std::tuple<filter_stage<IsEven>, transform_stage<TimesTen>, filter_stage<Below50>>>::value, "Stacked adapters must fuse their stages");
+static_assert(std::is_same<StackedRange::source_type, CustomContainerWithTrivialIteratorState>::value, "Stacked adapters must iterate the source container");
+static_assert(std::is_same<ConstTransformRange::source_type, const CustomContainerWithTrivialIteratorState>::value, "Adapters of const containers must keep the source const");
+static_assert(sizeof(TransformRange::iterator) == sizeof(void *) + sizeof(CustomContainerWithTrivialIteratorState::iterator_state<false>), "Transform only states must not carry the filter end and cache");
+
+// Hooks of `--it`, `it += n`, `last - first` and `it[n]` - these operators compile only if the state has the hook
+template<typename TState, typename = void>
+struct HasPrev: std::false_type {};
+
+template<typename TState>
+struct HasPrev<TState, std::void_t<decltype(std::declval<TState &>().prev())>>: std::true_type {};
+
+template<typename TState, typename = void>
+struct HasMove: std::false_type {};
+
+template<typename TState>
+struct HasMove<TState, std::void_t<decltype(std::declval<TState &>().move(1))>>: std::true_type {};
+
+template<typename TState, typename = void>
+struct HasDistance: std::false_type {};
+
+template<typename TState>
+struct HasDistance<TState, std::void_t<decltype(std::declval<const TState &>().distance(std::declval<const TState &>()))>>: std::true_type {};
+
+template<typename TState, typename = void>
+struct HasAt: std::false_type {};
+
+template<typename TState>
+struct HasAt<TState, std::void_t<decltype(std::declval<TState &>().at(1))>>: std::true_type {};
+
+typedef filter_state<CustomContainerWithTrivialIteratorState::iterator_state, IsEven, false> FilterState;
+typedef transform_state<CustomContainerWithTrivialIteratorState::iterator_state, TimesTen, false> TransformState;
+
+static_assert(HasPrev<TransformState>::value && HasMove<TransformState>::value && HasDistance<TransformState>::value && HasAt<TransformState>::value, "Transform only states must keep the random access hooks");
+static_assert(! HasPrev<FilterState>::value && ! HasMove<FilterState>::value && ! HasDistance<FilterState>::value && ! HasAt<FilterState>::value, "Filter states must not move backwards or by offsets, the source positions would skip the filter");
+
+#if __cplusplus >= 202002L
+static_assert(std::forward_iterator<FilterRange::iterator> && std::forward_iterator<StackedRange::const_iterator>, "Filter iterators must be forward iterators");
+static_assert(std::random_access_iterator<TransformRange::iterator>, "Transform iterators of random access sources must be random access iterators");
+#endif
+
+TEST(FilterTransformIterator, TestFilter) {
+    CustomContainerWithTrivialIteratorState container{1,2,3,4,5,6,7};
+
+    auto evens = make_filter_range(container, IsEven{});
+    for (CustomElement &element: evens) {
+        element.SetValue(element.GetValue() * 100);
+    }
+
+    EXPECT_THAT(container.InternalData, ElementsAre(1, 200, 3, 400, 5, 600, 7));
+    EXPECT_EQ(std::distance(evens.begin(), evens.end()), 3);
+}
+
+TEST(FilterTransformIterator, TestFilterWithoutPassingElements) {
+    CustomContainerWithTrivialIteratorState odds{1,3,5};
+    CustomContainerWithTrivialIteratorState empty;
+
+    EXPECT_EQ(make_filter_range(odds, IsEven{}).begin(), make_filter_range(odds, IsEven{}).end());
+    auto emptyEvens = make_filter_range(empty, IsEven{});
+    EXPECT_EQ(emptyEvens.begin(), emptyEvens.end());
+}
+
+TEST(FilterTransformIterator, TestTransformRandomAccess) {
+    CustomContainerWithTrivialIteratorState container{1,2,3,4};
+    const auto tens = make_transform_range(container, TimesTen{});
+
+    EXPECT_THAT(std::vector<int>(tens.begin(), tens.end()), ElementsAre(10, 20, 30, 40));
+    EXPECT_EQ(tens.end() - tens.begin(), 4);
+    EXPECT_EQ(tens.begin()[2], 30);
+    EXPECT_EQ(*(tens.end() - 1), 40);
+    EXPECT_EQ(std::accumulate(tens.begin(), tens.end(), 0), 100);
+}
+
+TEST(FilterTransformIterator, TestStackedAdapters) {
+    CustomContainerWithTrivialIteratorState container{1,2,3,4,5,6,7,8};
+
+    auto evens = make_filter_range(container, IsEven{});
+    auto tens = make_transform_range(evens, TimesTen{});
+    auto stacked = make_filter_range(tens, Below50{});
+    auto squares = make_transform_range(stacked, [](int value) { return value * value; });
+
+    EXPECT_THAT(std::vector<int>(tens.begin(), tens.end()), ElementsAre(20, 40, 60, 80));
+    EXPECT_THAT(std::vector<int>(stacked.begin(), stacked.end()), ElementsAre(20, 40));
+    EXPECT_THAT(std::vector<int>(squares.begin(), squares.end()), ElementsAre(400, 1600));
+}
+
+TEST(FilterTransformIterator, TestStagesRunOncePerElement) {
+    CustomContainerWithTrivialIteratorState container{1,2,3,4,5,6};
+    int predicateCalls = 0;
+    int transformCalls = 0;
+
+    auto tens = make_transform_range(container, [&transformCalls](const CustomElement &element) { ++transformCalls; return element.GetValue() * 10; });
+    auto evens = make_filter_range(tens, [&predicateCalls](int value) { ++predicateCalls; return value % 20 == 0; });
+
+    std::vector<int> values;
+    for (auto i = evens.begin(), end = evens.end(); i != end; ++i) {
+        values.push_back(*i);
+        values.push_back(*i);
+        EXPECT_TRUE(i != end);
+    }
+
+    EXPECT_THAT(values, ElementsAre(20, 20, 40, 40, 60, 60));
+    EXPECT_EQ(predicateCalls, 6);
+    EXPECT_EQ(transformCalls, 6);
+}
+
+TEST(FilterTransformIterator, TestConstElements) {
+    CustomContainerWithTrivialIteratorState container{1,2,3,4};
+    const CustomContainerWithTrivialIteratorState &constContainer = container;
+
+    auto constEvens = make_filter_range(constContainer, IsEven{});
+    static_assert(std::is_same<decltype(*constEvens.begin()), const CustomElement &>::value, "Adapters of const containers must return const elements");
+
+    auto evens = make_filter_range(container, IsEven{});
+    decltype(evens)::const_iterator first = evens.begin();
+    static_assert(std::is_same<decltype(*first), const CustomElement &>::value, "Const iterators must return const elements");
+
+    EXPECT_EQ(first->GetValue(), 2);
+    EXPECT_EQ(std::count_if(constEvens.begin(), constEvens.end(), [](const CustomElement &element) { return element.GetValue() > 2; }), 1);
+}
+
+TEST(FilterTransformIterator, TestReferenceTransforms) {
+    CustomContainerWithTrivialIteratorState container{1,2,3,4};
+    std::vector<int> targets(4);
+
+    auto slots = make_transform_range(container, [&targets](const CustomElement &element) -> int & { return targets[static_cast<std::size_t>(element.GetValue() - 1)]; });
+    auto evenSlots = make_filter_range(make_filter_range(container, IsEven{}), [](const CustomElement &) { return true; });
+    static_assert(std::is_same<decltype(slots)::iterator::reference, int &>::value, "Reference results must be passed through");
+
+    std::fill(slots.begin(), slots.end(), 7);
+    for (CustomElement &element: evenSlots) {
+        element.SetValue(0);
+    }
+
+    EXPECT_THAT(targets, ElementsAre(7, 7, 7, 7));
+    EXPECT_THAT(container.InternalData, ElementsAre(1, 0, 3, 0));
+}
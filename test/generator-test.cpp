@@ -0,0 +1,154 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/generator.hpp>
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+static generator<int> Count(int first, int last) {
+    for (int value = first; value < last; ++value) {
+        co_yield value;
+    }
+}
+
+static generator<std::string> Words() {
+    co_yield "lazy";
+    std::string word = "pooled";
+    co_yield word;
+    co_yield word + " frames";
+}
+
+static generator<int> Naturals() {
+    for (int value = 0;; ++value) {
+        co_yield value;
+    }
+}
+
+static generator<int> ThrowAfter(int count) {
+    for (int value = 0; value < count; ++value) {
+        co_yield value;
+    }
+    throw std::runtime_error("producer failed");
+}
+
+static generator<int> LargeFrame() {
+    volatile char scratch[2048] = {};
+    co_yield scratch[0];
+}
+
+static_assert(std::ranges::input_range<generator<int>>, "Generators must be input ranges");
+static_assert(std::is_same<std::iterator_traits<generator<int>::iterator>::iterator_category, std::input_iterator_tag>::value, "Generator iterators must be input iterators");
+static_assert(sizeof(generator<int>::iterator) == sizeof(void *), "Generator iterators must only point to the generator");
+
+TEST(Generator, TestYieldsValues) {
+    auto values = Count(1, 5);
+    EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 10);
+
+    std::vector<std::string> words;
+    for (const std::string &word: Words()) {
+        words.push_back(word);
+    }
+    EXPECT_THAT(words, ElementsAre("lazy", "pooled", "pooled frames"));
+}
+
+TEST(Generator, TestEmptyGenerator) {
+    auto values = Count(3, 3);
+    EXPECT_EQ(values.begin(), values.end());
+}
+
+TEST(Generator, TestPostIncrementReturnsOldValue) {
+    auto values = Count(0, 3);
+    auto it = values.begin();
+
+    EXPECT_EQ(*it++, 0);
+    EXPECT_EQ(*it, 1);
+    const auto old = it++;
+    EXPECT_EQ(*old, 1);
+    EXPECT_EQ(*it, 2);
+}
+
+TEST(Generator, TestInfiniteGeneratorAndMove) {
+    auto naturals = Naturals();
+    int sum = 0;
+    for (int value: naturals) {
+        if (value == 10) {
+            break;
+        }
+        sum += value;
+    }
+    EXPECT_EQ(sum, 45);
+
+    // The moved generator continues where the loop stopped
+    generator<int> moved(std::move(naturals));
+    EXPECT_EQ(*moved.begin(), 10);
+}
+
+TEST(Generator, TestExceptionsPropagate) {
+    auto values = ThrowAfter(2);
+    auto it = values.begin();
+    ++it;
+
+    EXPECT_THROW(++it, std::runtime_error);
+    EXPECT_EQ(it, values.end());
+}
+
+TEST(Generator, TestFramesComeFromThePool) {
+    // Warm up the pool of this thread
+    for (int value: Count(0, 1)) {
+        static_cast<void>(value);
+    }
+
+    const std::size_t heapAllocations = detail::frame_pool::heap_allocations();
+    int sum = 0;
+    for (int round = 0; round < 100; ++round) {
+        for (int value: Count(0, 10)) {
+            sum += value;
+        }
+    }
+
+    EXPECT_EQ(sum, 4500);
+    EXPECT_EQ(detail::frame_pool::heap_allocations(), heapAllocations);
+}
+
+TEST(Generator, TestLargeFramesUseTheHeap) {
+    const std::size_t heapAllocations = detail::frame_pool::heap_allocations();
+
+    for (int round = 0; round < 3; ++round) {
+        for (int value: LargeFrame()) {
+            EXPECT_EQ(value, 0);
+        }
+    }
+
+    EXPECT_EQ(detail::frame_pool::heap_allocations(), heapAllocations + 3);
+}
+
+// Owner of a generator outliving the frame pool of its thread: constructed before the pool, destroyed after it
+struct ThreadLocalGeneratorOwner {
+    std::optional<generator<int>> values;
+};
+
+TEST(Generator, TestFramesDestroyedAfterThePool) {
+    int sum = 0;
+    std::thread thread([&sum]() {
+        static thread_local ThreadLocalGeneratorOwner owner;
+        owner.values.emplace(Count(0, 4));
+        for (int value: *owner.values) {
+            sum += value;
+        }
+    });
+    thread.join();
+
+    EXPECT_EQ(sum, 6);
+}
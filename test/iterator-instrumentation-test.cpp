@@ -0,0 +1,132 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <tmc/foundation/bit-packed-vector.hpp>
+#include <tmc/foundation/iterator-instrumentation.hpp>
+#include "custom-container-skeletons.hpp"
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+typedef custom_iterator_template<CustomContainerWithTrivialIteratorState::iterator_state, false, default_iterator_policy, counting_instrumentation> CountingIterator;
+typedef custom_iterator_template<CustomContainerWithTrivialIteratorState::iterator_state, true, default_iterator_policy, counting_instrumentation> CountingConstIterator;
+
+static_assert(sizeof(CustomContainerWithTrivialIteratorState::iterator) == sizeof(CustomContainerWithTrivialIteratorState::iterator_state<false>), "Uninstrumented iterators are the state only");
+static_assert(std::is_trivially_copyable<CustomContainerWithTrivialIteratorState::iterator>::value, "Uninstrumented iterators of trivial states stay trivially copyable");
+static_assert(! std::is_trivially_copyable<CountingIterator>::value, "Instrumented iterators count their copies");
+
+static CustomContainerWithTrivialIteratorState MakeContainer(int count) {
+    CustomContainerWithTrivialIteratorState container;
+    for (int value = 0; value < count; ++value) {
+        container.InternalData.push_back(CustomElement(value));
+    }
+    return container;
+}
+
+TEST(IteratorInstrumentation, TestCountsOperations) {
+    const auto container = MakeContainer(10);
+    counting_instrumentation::reset<CountingConstIterator>();
+
+    int sum = 0;
+    for (auto it = CountingConstIterator::begin(&container), last = CountingConstIterator::end(&container); it != last; ++it) {
+        sum += it->GetValue();
+    }
+    EXPECT_EQ(sum, 45);
+
+    auto it = CountingConstIterator::begin(&container);
+    it += 5;
+    --it;
+    EXPECT_EQ(it[1].GetValue(), 5);
+
+    const iterator_operation_counts counts = counting_instrumentation::counts<CountingConstIterator>();
+    EXPECT_EQ(counts[iterator_operation::next], 10u);
+    EXPECT_EQ(counts[iterator_operation::is_equal], 11u);
+    EXPECT_EQ(counts[iterator_operation::get], 11u);
+    EXPECT_EQ(counts[iterator_operation::move], 1u);
+    EXPECT_EQ(counts[iterator_operation::prev], 1u);
+}
+
+template<bool is_const>
+using BitPackedState = bit_packed_state<5, is_const>;
+
+typedef custom_iterator_template<BitPackedState, false, default_iterator_policy, counting_instrumentation> CountingProxyIterator;
+
+TEST(IteratorInstrumentation, TestCountsOneGetPerArrowOfProxyReferences) {
+    bit_packed_vector<5> container{1, 2, 3};
+    counting_instrumentation::reset<CountingProxyIterator>();
+
+    const auto it = CountingProxyIterator::begin(&container) + 1;
+    const auto arrow = it.operator->();
+    EXPECT_EQ(static_cast<bit_packed_value_t<5>>(*arrow.operator->()), 2u);
+    EXPECT_EQ(counting_instrumentation::counts<CountingProxyIterator>()[iterator_operation::get], 1u);
+}
+
+TEST(IteratorInstrumentation, TestCountsCopiesOfPostIncrementAndReverseIterators) {
+    auto container = MakeContainer(100);
+    counting_instrumentation::reset<CountingIterator>();
+
+    for (auto it = CountingIterator::begin(&container), last = CountingIterator::end(&container); it != last; ++it) {
+        static_cast<void>(*it);
+    }
+    const std::uint64_t prefixCopies = counting_instrumentation::counts<CountingIterator>()[iterator_operation::copy];
+
+    for (auto it = CountingIterator::begin(&container), last = CountingIterator::end(&container); it != last; it++) {
+        static_cast<void>(*it);
+    }
+    const std::uint64_t postfixCopies = counting_instrumentation::counts<CountingIterator>()[iterator_operation::copy] - prefixCopies;
+
+    std::reverse_iterator<CountingIterator> first(CountingIterator::end(&container));
+    std::reverse_iterator<CountingIterator> last(CountingIterator::begin(&container));
+    for (; first != last; ++first) {
+        static_cast<void>(*first);
+    }
+    const std::uint64_t reverseCopies = counting_instrumentation::counts<CountingIterator>()[iterator_operation::copy] - prefixCopies - postfixCopies;
+
+    EXPECT_LT(prefixCopies, 10u);
+    EXPECT_GE(postfixCopies, 100u);
+    // `std::reverse_iterator::operator*` decrements a copy
+    EXPECT_GE(reverseCopies, 100u);
+    // ... and decrements on increment
+    EXPECT_EQ(counting_instrumentation::counts<CountingIterator>()[iterator_operation::prev], 200u);
+}
+
+TEST(IteratorInstrumentation, TestConcurrentCountingIsExact) {
+    const auto container = MakeContainer(1000);
+    counting_instrumentation::reset<CountingConstIterator>();
+
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&container] {
+            for (int round = 0; round < 100; ++round) {
+                EXPECT_EQ(std::count(CountingConstIterator::begin(&container), CountingConstIterator::end(&container), CustomElement(7)), 1);
+            }
+        });
+    }
+    for (auto &thread: threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counting_instrumentation::counts<CountingConstIterator>()[iterator_operation::next], 4u * 100u * 1000u);
+    EXPECT_EQ(counting_instrumentation::counts<CountingConstIterator>()[iterator_operation::get], 4u * 100u * 1000u);
+}
+
+TEST(IteratorInstrumentation, TestReportListsIteratorTypes) {
+    auto container = MakeContainer(3);
+    counting_instrumentation::reset<CountingIterator>();
+    std::for_each(CountingIterator::begin(&container), CountingIterator::end(&container), [](CustomElement &) {});
+
+    const auto report = counting_instrumentation::report();
+    const auto entry = std::find_if(report.begin(), report.end(), [](const iterator_operation_report &current) {
+        return current.counts[iterator_operation::next] == 3u && current.iterator_name.find("custom_iterator_template") != std::string::npos &&
+               current.iterator_name.find("counting_instrumentation") != std::string::npos;
+    });
+    ASSERT_NE(entry, report.end());
+    EXPECT_GE(entry->counts.total(), 3u + 4u);
+}
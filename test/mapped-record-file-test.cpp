@@ -0,0 +1,134 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/mapped-record-file.hpp>
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+struct MappedRecord {
+    int64_t key;
+    int32_t value;
+    int32_t flags;
+};
+
+typedef mapped_record_file<MappedRecord> MappedRecordFile;
+
+static_assert(std::is_same<std::iterator_traits<MappedRecordFile::iterator>::iterator_category, std::random_access_iterator_tag>::value, "Mapped record iterators must be random access");
+static_assert(std::is_trivially_copyable<MappedRecordFile::const_iterator>::value, "Mapped record iterators must be trivially copyable");
+static_assert(!std::is_copy_constructible<MappedRecordFile>::value, "Mappings must not be copyable");
+
+// Temporary file removed at the end of the test
+struct TemporaryFile {
+    std::string path;
+
+    explicit TemporaryFile(const std::string &name): path(::testing::TempDir() + name + "-" + std::to_string(::getpid())) {}
+    ~TemporaryFile() { std::remove(path.c_str()); }
+
+    void write(const std::vector<MappedRecord> &records, std::size_t trailingBytes = 0) const {
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream.write(reinterpret_cast<const char *>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(MappedRecord)));
+        const std::string trailing(trailingBytes, 'x');
+        stream.write(trailing.data(), static_cast<std::streamsize>(trailing.size()));
+    }
+};
+
+static std::vector<MappedRecord> MakeMappedRecords(int count) {
+    std::vector<MappedRecord> records;
+    for (int index = 0; index < count; ++index) {
+        records.push_back(MappedRecord{index * 10, index, 0});
+    }
+    return records;
+}
+
+TEST(MappedRecordFile, TestReadsRecordsInPlace) {
+    TemporaryFile file("mapped-records");
+    file.write(MakeMappedRecords(1000));
+
+    const MappedRecordFile records(file.path, access_hint::sequential);
+
+    EXPECT_EQ(records.size(), 1000u);
+    EXPECT_EQ(records.size_bytes(), 1000u * sizeof(MappedRecord));
+    EXPECT_EQ(&*records.begin(), records.data());
+    EXPECT_EQ(std::accumulate(records.begin(), records.end(), int64_t{0}, [](int64_t sum, const MappedRecord &record) { return sum + record.value; }), int64_t{499500});
+}
+
+TEST(MappedRecordFile, TestRandomAccess) {
+    TemporaryFile file("mapped-records-random");
+    file.write(MakeMappedRecords(100));
+
+    const MappedRecordFile records(file.path, access_hint::random);
+
+    auto it = std::lower_bound(records.begin(), records.end(), int64_t{420}, [](const MappedRecord &record, int64_t key) { return record.key < key; });
+    EXPECT_EQ(it - records.begin(), 42);
+    EXPECT_EQ(it->value, 42);
+    EXPECT_EQ(it[-2].value, 40);
+    EXPECT_EQ(records[99].key, 990);
+    EXPECT_EQ(records.rbegin()->value, 99);
+    EXPECT_EQ(records.end() - records.begin(), 100);
+}
+
+TEST(MappedRecordFile, TestIgnoresIncompleteTrailingRecord) {
+    TemporaryFile file("mapped-records-trailing");
+    file.write(MakeMappedRecords(3), sizeof(MappedRecord) - 1);
+
+    const MappedRecordFile records(file.path);
+
+    EXPECT_EQ(records.size(), 3u);
+    EXPECT_EQ(std::distance(records.begin(), records.end()), 3);
+}
+
+TEST(MappedRecordFile, TestEmptyFile) {
+    TemporaryFile file("mapped-records-empty");
+    file.write({});
+
+    const MappedRecordFile records(file.path);
+
+    EXPECT_TRUE(records.empty());
+    EXPECT_EQ(records.begin(), records.end());
+}
+
+TEST(MappedRecordFile, TestMissingFileThrows) {
+    EXPECT_THROW(MappedRecordFile("/nonexistent/mapped-records"), std::system_error);
+}
+
+TEST(MappedRecordFile, TestHugePageAlignment) {
+    TemporaryFile file("mapped-records-huge");
+    file.write(MakeMappedRecords(10000));
+
+    const MappedRecordFile records(file.path, access_hint::sequential, true);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(records.data()) % huge_page_size, 0u);
+    EXPECT_EQ(records.rbegin()->key, 99990);
+}
+
+TEST(MappedRecordFile, TestAdviseAndMove) {
+    TemporaryFile file("mapped-records-move");
+    file.write(MakeMappedRecords(10));
+
+    MappedRecordFile source(file.path, access_hint::will_need);
+    source.advise(access_hint::random);
+    const MappedRecord *data = source.data();
+
+    MappedRecordFile target(std::move(source));
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(target.data(), data);
+
+    source = std::move(target);
+    EXPECT_EQ(source.data(), data);
+    EXPECT_EQ(source.cbegin()[9].value, 9);
+}
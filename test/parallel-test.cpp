@@ -0,0 +1,133 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/parallel.hpp>
+#include "custom-container-skeletons.hpp"
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+// The trivial state does not count connections - the iterators are copied on several threads
+static CustomContainerWithTrivialIteratorState MakeContainer(int elementCount) {
+    CustomContainerWithTrivialIteratorState container;
+    for (int value = 0; value < elementCount; ++value) {
+        container.InternalData.push_back(CustomElement(value));
+    }
+    return container;
+}
+
+class ParallelAlgorithms: public TestWithParam<size_t> {};
+
+INSTANTIATE_TEST_SUITE_P(ThreadCounts, ParallelAlgorithms, Values(1, 2, 4));
+
+TEST_P(ParallelAlgorithms, TestInvokeRunsBothFunctions) {
+    thread_pool pool(GetParam());
+    std::atomic<int> left{0};
+    std::atomic<int> right{0};
+
+    pool.invoke([&] { ++left; }, [&] { ++right; });
+
+    EXPECT_EQ(pool.thread_count(), GetParam());
+    EXPECT_EQ(left, 1);
+    EXPECT_EQ(right, 1);
+}
+
+TEST_P(ParallelAlgorithms, TestInvokePropagatesExceptions) {
+    thread_pool pool(GetParam());
+
+    EXPECT_THROW(pool.invoke([] {}, [] { throw std::runtime_error("right"); }), std::runtime_error);
+    EXPECT_THROW(pool.invoke([] { throw std::runtime_error("left"); }, [] {}), std::runtime_error);
+}
+
+TEST_P(ParallelAlgorithms, TestParallelForEach) {
+    thread_pool pool(GetParam());
+    auto container = MakeContainer(10000);
+
+    parallel_for_each(pool, container.begin(), container.end(), [](CustomElement &element) { element.SetValue(element.GetValue() + 1); }, 64);
+
+    for (int index = 0; index < 10000; ++index) {
+        ASSERT_EQ(container.InternalData[index].GetValue(), index + 1);
+    }
+}
+
+TEST_P(ParallelAlgorithms, TestParallelForEachSubrangeAndEmptyRange) {
+    thread_pool pool(GetParam());
+    auto container = MakeContainer(100);
+    std::atomic<int> visited{0};
+
+    parallel_for_each(pool, container.cbegin() + 10, container.cend() - 10, [&visited](const CustomElement &) { ++visited; }, 4);
+    parallel_for_each(pool, container.cbegin(), container.cbegin(), [&visited](const CustomElement &) { ++visited; });
+
+    EXPECT_EQ(visited, 80);
+}
+
+TEST_P(ParallelAlgorithms, TestParallelTransformReduce) {
+    thread_pool pool(GetParam());
+    auto container = MakeContainer(10000);
+
+    const auto value = [](const CustomElement &element) { return static_cast<int64_t>(element.GetValue()); };
+
+    EXPECT_EQ(parallel_transform_reduce(pool, container.cbegin(), container.cend(), int64_t{0}, std::plus<>(), value, 64), int64_t{49995000});
+    EXPECT_EQ(parallel_transform_reduce(pool, container.cbegin(), container.cend(), int64_t{5}, std::plus<>(), value), int64_t{49995005});
+    EXPECT_EQ(parallel_transform_reduce(pool, container.cbegin() + 1, container.cbegin() + 4, int64_t{1}, std::multiplies<>(), value, 1), int64_t{6});
+    EXPECT_EQ(parallel_transform_reduce(pool, container.cbegin(), container.cbegin(), int64_t{7}, std::plus<>(), value), int64_t{7});
+}
+
+TEST_P(ParallelAlgorithms, TestParallelSort) {
+    thread_pool pool(GetParam());
+    auto container = MakeContainer(10000);
+    // Many duplicates for the three way partitioning
+    for (auto &element: container.InternalData) {
+        element.SetValue(element.GetValue() % 1000);
+    }
+    std::shuffle(container.InternalData.begin(), container.InternalData.end(), std::mt19937(42));
+
+    auto expected = container.InternalData;
+    const auto less = [](const CustomElement &lhs, const CustomElement &rhs) { return lhs.GetValue() < rhs.GetValue(); };
+    std::sort(expected.begin(), expected.end(), less);
+
+    parallel_sort(pool, container.begin(), container.end(), less, 64);
+
+    EXPECT_THAT(container.InternalData, ::testing::ContainerEq(expected));
+}
+
+TEST_P(ParallelAlgorithms, TestParallelSortOfPresortedAndEqualElements) {
+    thread_pool pool(GetParam());
+    const auto less = [](const CustomElement &lhs, const CustomElement &rhs) { return lhs.GetValue() < rhs.GetValue(); };
+
+    auto ascending = MakeContainer(5000);
+    auto descending = MakeContainer(5000);
+    std::reverse(descending.InternalData.begin(), descending.InternalData.end());
+    auto equal = MakeContainer(5000);
+    std::fill(equal.InternalData.begin(), equal.InternalData.end(), CustomElement(3));
+
+    parallel_sort(pool, ascending.begin(), ascending.end(), less, 16);
+    parallel_sort(pool, descending.begin(), descending.end(), less, 16);
+    parallel_sort(pool, equal.begin(), equal.end(), less, 16);
+
+    EXPECT_TRUE(std::is_sorted(ascending.begin(), ascending.end(), less));
+    EXPECT_THAT(descending.InternalData, ::testing::ContainerEq(MakeContainer(5000).InternalData));
+    EXPECT_EQ(std::count(equal.begin(), equal.end(), CustomElement(3)), 5000);
+}
+
+TEST(ParallelAlgorithms, TestDefaultPool) {
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    std::reverse(values.begin(), values.end());
+
+    parallel_sort(values.begin(), values.end());
+    parallel_for_each(values.begin(), values.end(), [](int &value) { value *= 2; });
+
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+    EXPECT_EQ(parallel_transform_reduce(values.begin(), values.end(), 0, std::plus<>(), [](int value) { return value; }), 999000);
+}
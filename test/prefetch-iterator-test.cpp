@@ -0,0 +1,185 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/prefetch-iterator.hpp>
+#include "custom-container-skeletons.hpp"
+#include "linked-node-list.hpp"
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+template<bool is_const>
+using PrefetchingRandomAccessState = prefetch_state<CustomContainerWithTrivialIteratorState::iterator_state, 4, is_const>;
+
+template<bool is_const>
+using PrefetchingBidirectionalState = prefetch_state<CustomContainerWithBidirectionalIterator::iterator_state, 3, is_const>;
+
+typedef custom_iterator_template<PrefetchingRandomAccessState, false> PrefetchingRandomAccessIterator;
+typedef custom_iterator_template<PrefetchingRandomAccessState, true> PrefetchingRandomAccessConstIterator;
+typedef custom_iterator_template<PrefetchingBidirectionalState, false> PrefetchingBidirectionalIterator;
+
+#if __cplusplus >= 202002L
+// Bidirectional state handing out its own batches
+template<bool is_const>
+struct ChunkedBidirectionalState: CustomContainerWithBidirectionalIterator::iterator_state<is_const> {
+    using CustomContainerWithBidirectionalIterator::iterator_state<is_const>::iterator_state;
+
+    inline std::span<typename ChunkedBidirectionalState::value_type> next_chunk(std::ptrdiff_t max) {
+        const auto count = std::min(max, std::distance(this->current_, this->container_->InternalData.end()));
+        std::span<typename ChunkedBidirectionalState::value_type> chunk(&*this->current_, static_cast<std::size_t>(count));
+        std::advance(this->current_, count);
+        return chunk;
+    }
+};
+
+template<bool is_const>
+using PrefetchingChunkedState = prefetch_state<ChunkedBidirectionalState, 2, is_const>;
+
+static_assert(detail::has_next_chunk<ChunkedBidirectionalState<false>>::value, "The decorated state hands out batches");
+static_assert(!detail::has_next_chunk<PrefetchingChunkedState<false>>::value, "next_chunk() would move the decorated state without the lookahead");
+#endif
+
+template<bool is_const>
+using PrefetchingPointerState = prefetch_state<CustomContainerWithPointerIteratorState::iterator_state, 4, is_const>;
+
+// Decorator deriving from a collapsing state without declaring the flag or `address()` itself
+template<bool is_const>
+struct CountingPointerState: CustomContainerWithPointerIteratorState::iterator_state<is_const> {
+    using CustomContainerWithPointerIteratorState::iterator_state<is_const>::iterator_state;
+
+    inline void next() {
+        CustomContainerWithPointerIteratorState::iterator_state<is_const>::next();
+        ++steps_;
+    }
+
+    std::size_t steps_{0};
+};
+
+static_assert(std::is_same<std::iterator_traits<PrefetchingRandomAccessIterator>::iterator_category, std::random_access_iterator_tag>::value, "The decorator must keep the iterator category");
+static_assert(std::is_same<std::iterator_traits<LinkedNodeList<int, 8>::iterator>::iterator_category, std::forward_iterator_tag>::value, "The decorator must keep the iterator category");
+static_assert(std::is_trivially_copyable<LinkedNodeList<int, 8>::iterator>::value, "Decorated trivial states must stay trivially copyable");
+
+template<std::size_t Distance>
+static std::vector<int> ShuffledListValues(int count) {
+    LinkedNodeList<int, Distance> list;
+    for (int value = 0; value < count; ++value) {
+        list.push_back(value);
+    }
+    list.shuffle_nodes(42);
+    return std::vector<int>(list.cbegin(), list.cend());
+}
+
+TEST(PrefetchIterator, TestForwardLookaheadVisitsAllNodes) {
+    std::vector<int> expected(100);
+    std::iota(expected.begin(), expected.end(), 0);
+
+    EXPECT_EQ(ShuffledListValues<0>(100), expected);
+    EXPECT_EQ(ShuffledListValues<1>(100), expected);
+    EXPECT_EQ(ShuffledListValues<8>(100), expected);
+    // Lookahead longer than the list
+    EXPECT_EQ(ShuffledListValues<1000>(100), expected);
+    EXPECT_TRUE(ShuffledListValues<8>(0).empty());
+}
+
+TEST(PrefetchIterator, TestForwardIteratorOperations) {
+    LinkedNodeList<int, 2> list{1, 2, 3, 4, 5};
+
+    auto it = std::find(list.begin(), list.end(), 3);
+    ASSERT_NE(it, list.end());
+    *it = 30;
+    LinkedNodeList<int, 2>::const_iterator constIt = it;
+
+    EXPECT_EQ(*constIt++, 30);
+    EXPECT_EQ(*constIt, 4);
+    EXPECT_EQ(std::distance(list.cbegin(), list.cend()), 5);
+    EXPECT_THAT(std::vector<int>(list.begin(), list.end()), ElementsAre(1, 2, 30, 4, 5));
+}
+
+TEST(PrefetchIterator, TestBidirectionalLookaheadFollowsPrev) {
+    CustomContainerWithBidirectionalIterator container{1, 2, 3, 4, 5, 6};
+    auto it = PrefetchingBidirectionalIterator::begin(&container);
+    const auto last = PrefetchingBidirectionalIterator::end(&container);
+
+    // Forward to the end, the lookahead waits at the end, back and forward again
+    std::advance(it, 5);
+    EXPECT_EQ(it->GetValue(), 6);
+    std::advance(it, -4);
+    EXPECT_EQ(it->GetValue(), 2);
+    ++it;
+    EXPECT_EQ(it->GetValue(), 3);
+    EXPECT_EQ(std::distance(it, last), 4);
+
+    std::vector<int> backwards;
+    for (auto current = last; current != PrefetchingBidirectionalIterator::begin(&container);) {
+        --current;
+        backwards.push_back(current->GetValue());
+    }
+    EXPECT_THAT(backwards, ElementsAre(6, 5, 4, 3, 2, 1));
+}
+
+TEST(PrefetchIterator, TestRandomAccessDecorator) {
+    CustomContainerWithTrivialIteratorState container{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto first = PrefetchingRandomAccessIterator::begin(&container);
+    const auto last = PrefetchingRandomAccessIterator::end(&container);
+
+    EXPECT_EQ(last - first, 10);
+    EXPECT_EQ(first[9].GetValue(), 10);
+    EXPECT_EQ(std::accumulate(first, last, 0, [](int sum, const CustomElement &element) { return sum + element.GetValue(); }), 55);
+
+    PrefetchingRandomAccessConstIterator constFirst = first + 7;
+    EXPECT_EQ(constFirst->GetValue(), 8);
+    EXPECT_EQ(*std::lower_bound(first, last, CustomElement(6), [](const CustomElement &lhs, const CustomElement &rhs) { return lhs.GetValue() < rhs.GetValue(); }), CustomElement(6));
+}
+
+TEST(PrefetchIterator, TestDecoratedCollapsingStatesKeepTheirSize) {
+    typedef custom_iterator_template<PrefetchingPointerState, false, unchecked_iterator_policy> UncheckedPrefetchingPointerIterator;
+    typedef custom_iterator_template<CountingPointerState, false, unchecked_iterator_policy> UncheckedCountingPointerIterator;
+    static_assert(sizeof(UncheckedPrefetchingPointerIterator) == sizeof(PrefetchingPointerState<false>), "Decorated collapsing states must keep the decorator members");
+    static_assert(sizeof(UncheckedCountingPointerIterator) == sizeof(CountingPointerState<false>), "States inheriting address() must not collapse");
+
+    CustomContainerWithPointerIteratorState container{1, 2, 3, 4, 5, 6};
+    auto first = UncheckedPrefetchingPointerIterator::begin(&container);
+    const auto last = UncheckedPrefetchingPointerIterator::end(&container);
+    EXPECT_EQ(last - first, 6);
+    EXPECT_EQ(std::accumulate(first, last, 0, [](int sum, const CustomElement &element) { return sum + element.GetValue(); }), 21);
+
+    auto counted = UncheckedCountingPointerIterator::begin(&container);
+    std::advance(counted, 2);
+    ++counted;
+    EXPECT_EQ(counted->GetValue(), 4);
+}
+
+#if __cplusplus >= 202002L
+TEST(PrefetchIterator, TestChunkedAccessMovesTheLookahead) {
+    typedef custom_iterator_template<PrefetchingChunkedState, false> PrefetchingChunkedIterator;
+    CustomContainerWithBidirectionalIterator container{1, 2, 3, 4, 5, 6};
+    auto it = PrefetchingChunkedIterator::begin(&container);
+    const auto last = PrefetchingChunkedIterator::end(&container);
+
+    std::vector<int> values;
+    for (auto chunk = it.next_chunk(last, 4); !chunk.empty(); chunk = it.next_chunk(last, 4)) {
+        EXPECT_EQ(chunk.size(), 1u);
+        values.push_back(chunk[0].GetValue());
+        if (values.size() == 3) {
+            break;
+        }
+    }
+    EXPECT_THAT(values, ElementsAre(1, 2, 3));
+    EXPECT_EQ(it->GetValue(), 4);
+
+    // The lookahead followed the batches: back and forth over the end stays in sync
+    std::advance(it, 2);
+    EXPECT_EQ(it->GetValue(), 6);
+    std::advance(it, -3);
+    EXPECT_EQ(it->GetValue(), 3);
+    EXPECT_EQ(std::distance(it, last), 4);
+}
+#endif
@@ -0,0 +1,128 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/custom-iterator-template.hpp>
+#include "custom-container-skeletons.hpp"
+#include "soa-container.hpp"
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+static SoAContainer MakeSoAContainer(std::initializer_list<int64_t> keys) {
+    SoAContainer container;
+    for (int64_t key: keys) {
+        container.push_back(SoAElement{key, key * 0.5, key * 2.0});
+    }
+    return container;
+}
+
+static std::vector<int64_t> Keys(const SoAContainer &container) {
+    std::vector<int64_t> keys;
+    for (auto it = container.cbegin(); it != container.cend(); ++it) {
+        keys.push_back(it->key);
+    }
+    return keys;
+}
+
+// Element references - the default without `reference` in the state
+static_assert(std::is_same<CustomContainerWithRandomAccessIterator::iterator::reference, CustomElement &>::value, "States without reference typedef must use value_type &");
+static_assert(std::is_same<CustomContainerWithRandomAccessIterator::iterator::pointer, CustomElement *>::value, "States without reference typedef must use value_type *");
+static_assert(std::is_same<CustomContainerWithRandomAccessIterator::const_iterator::reference, const CustomElement &>::value, "States without reference typedef must use value_type &");
+
+// Proxy references
+static_assert(std::is_same<SoAContainer::iterator::reference, SoAReference<false>>::value, "The state's reference typedef must be used");
+static_assert(std::is_same<SoAContainer::const_iterator::reference, SoAReference<true>>::value, "The state's reference typedef must be used");
+static_assert(std::is_same<SoAContainer::iterator::pointer, arrow_proxy<SoAReference<false>>>::value, "Proxy references must use the arrow proxy");
+static_assert(std::is_same<std::iterator_traits<SoAContainer::iterator>::reference, SoAReference<false>>::value, "iterator_traits must report the proxy");
+static_assert(std::is_same<decltype(*std::declval<SoAContainer::iterator>()), SoAReference<false>>::value, "operator* must return the proxy");
+
+TEST(ProxyReference, TestElementAccess) {
+    SoAContainer container = MakeSoAContainer({1,2,3});
+
+    auto it = container.begin();
+    EXPECT_EQ((*it).key, 1);
+    EXPECT_EQ(it->value, 0.5);
+    EXPECT_EQ(it[2].weight, 6.0);
+    EXPECT_EQ((it + 1)->key, 2);
+
+    it->value = 7.5;
+    *(it + 2) = SoAElement{30, 1.0, 2.0};
+
+    EXPECT_EQ(container.values()[0], 7.5);
+    EXPECT_THAT(container.keys(), ::testing::ContainerEq(std::vector<int64_t>({1,2,30})));
+}
+
+TEST(ProxyReference, TestConversionToValueType) {
+    SoAContainer container = MakeSoAContainer({4,5});
+
+    SoAElement element = *container.cbegin();
+    std::vector<SoAElement> elements(container.begin(), container.end());
+
+    EXPECT_EQ(element.key, 4);
+    EXPECT_EQ(element.weight, 8.0);
+    EXPECT_EQ(elements.size(), 2u);
+    EXPECT_EQ(elements[1].value, 2.5);
+}
+
+TEST(ProxyReference, TestAssignmentCopiesTheValues) {
+    SoAContainer container = MakeSoAContainer({1,2});
+
+    *container.begin() = *(container.begin() + 1);
+    container.begin()[1].key = 9;
+
+    EXPECT_THAT(container.keys(), ::testing::ContainerEq(std::vector<int64_t>({2,9})));
+    EXPECT_THAT(container.values(), ::testing::ContainerEq(std::vector<double>({1.0,1.0})));
+}
+
+TEST(ProxyReference, TestSwapAndIterSwap) {
+    SoAContainer container = MakeSoAContainer({1,2,3});
+
+    swap(*container.begin(), *(container.begin() + 2));
+    EXPECT_THAT(container.keys(), ::testing::ContainerEq(std::vector<int64_t>({3,2,1})));
+    EXPECT_THAT(container.weights(), ::testing::ContainerEq(std::vector<double>({6.0,4.0,2.0})));
+
+    std::iter_swap(container.begin(), container.begin() + 1);
+    EXPECT_THAT(container.keys(), ::testing::ContainerEq(std::vector<int64_t>({2,3,1})));
+}
+
+TEST(ProxyReference, TestStdSortKeepsRowsTogether) {
+    std::vector<int64_t> keys(1000);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+    SoAContainer container;
+    for (int64_t key: keys) {
+        container.push_back(SoAElement{key, key * 0.5, key * 2.0});
+    }
+
+    std::sort(container.begin(), container.end(), [](const auto &lhs, const auto &rhs) { return lhs.key < rhs.key; });
+
+    for (std::size_t index = 0; index < container.size(); ++index) {
+        ASSERT_EQ(container.keys()[index], static_cast<int64_t>(index));
+        ASSERT_EQ(container.values()[index], index * 0.5);
+        ASSERT_EQ(container.weights()[index], index * 2.0);
+    }
+}
+
+TEST(ProxyReference, TestReverseIterationAndAlgorithms) {
+    SoAContainer container = MakeSoAContainer({3,1,2});
+
+    std::vector<int64_t> reversed;
+    for (auto it = container.rbegin(); it != container.rend(); ++it) {
+        reversed.push_back((*it).key);
+    }
+    std::reverse(container.begin(), container.end());
+
+    EXPECT_THAT(reversed, ::testing::ContainerEq(std::vector<int64_t>({2,1,3})));
+    EXPECT_THAT(Keys(container), ::testing::ContainerEq(std::vector<int64_t>({2,1,3})));
+    EXPECT_TRUE(std::find_if(container.cbegin(), container.cend(), [](const auto &element) { return element.key == 1; }) == container.cbegin() + 1);
+}
@@ -0,0 +1,150 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/algorithms.hpp>
+#include "custom-container-skeletons.hpp"
+#include "block-container.hpp"
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+// Small blocks to cross many block boundaries
+typedef BlockContainer<int, 4> SmallBlockContainer;
+
+static SmallBlockContainer MakeBlockContainer(int elementCount) {
+    SmallBlockContainer container;
+    for (int value = 1; value <= elementCount; ++value) {
+        container.push_back(value);
+    }
+    return container;
+}
+
+static std::vector<int> MakeVector(int first, int last) {
+    std::vector<int> values;
+    for (int value = first; value <= last; ++value) {
+        values.push_back(value);
+    }
+    return values;
+}
+
+static_assert(segmented_iterator_traits<SmallBlockContainer::iterator>::is_segmented, "Block container iterators must be segmented");
+static_assert(segmented_iterator_traits<SmallBlockContainer::const_iterator>::is_segmented, "Block container const iterators must be segmented");
+static_assert(! segmented_iterator_traits<CustomContainerWithRandomAccessIterator::iterator>::is_segmented, "Plain states must not be segmented");
+static_assert(! segmented_iterator_traits<std::vector<int>::iterator>::is_segmented, "std iterators must not be segmented");
+
+TEST(SegmentedIterator, TestBlockContainerIteration) {
+    SmallBlockContainer container = MakeBlockContainer(10);
+
+    std::vector<int> forward(container.begin(), container.end());
+    std::vector<int> backward(container.rbegin(), container.rend());
+
+    EXPECT_THAT(forward, ::testing::ContainerEq(MakeVector(1, 10)));
+    EXPECT_THAT(backward, ::testing::ContainerEq(std::vector<int>({10,9,8,7,6,5,4,3,2,1})));
+    EXPECT_EQ(container.end() - container.begin(), 10);
+    EXPECT_EQ(*(container.begin() + 7), 8);
+    EXPECT_EQ(container.begin()[9], 10);
+    EXPECT_TRUE(container.begin() + 10 == container.end());
+}
+
+TEST(SegmentedIterator, TestBlockContainerFullLastBlock) {
+    SmallBlockContainer empty;
+    SmallBlockContainer container = MakeBlockContainer(8);
+
+    EXPECT_TRUE(empty.begin() == empty.end());
+    EXPECT_TRUE(container.begin() + 8 == container.end());
+    EXPECT_THAT(std::vector<int>(container.begin(), container.end()), ::testing::ContainerEq(MakeVector(1, 8)));
+}
+
+TEST(SegmentedIterator, TestAccumulate) {
+    SmallBlockContainer empty;
+    SmallBlockContainer container = MakeBlockContainer(10);
+
+    EXPECT_EQ(tmc::foundation::accumulate(empty.begin(), empty.end(), 0), 0);
+    EXPECT_EQ(tmc::foundation::accumulate(container.begin(), container.end(), 0), 55);
+    EXPECT_EQ(tmc::foundation::accumulate(container.begin() + 1, container.begin() + 3, 0), 5);
+    EXPECT_EQ(tmc::foundation::accumulate(container.begin() + 3, container.begin() + 9, 0), 4+5+6+7+8+9);
+    EXPECT_EQ(tmc::foundation::accumulate(container.cbegin(), container.cend(), 1, std::multiplies<>()), 3628800);
+}
+
+TEST(SegmentedIterator, TestForEach) {
+    SmallBlockContainer container = MakeBlockContainer(10);
+
+    std::vector<int> visited;
+    tmc::foundation::for_each(container.begin() + 2, container.end(), [&visited](int value) { visited.push_back(value); });
+
+    EXPECT_THAT(visited, ::testing::ContainerEq(MakeVector(3, 10)));
+}
+
+TEST(SegmentedIterator, TestCopy) {
+    SmallBlockContainer container = MakeBlockContainer(10);
+
+    std::vector<int> target(10, 0);
+    auto result = tmc::foundation::copy(container.begin() + 1, container.begin() + 9, target.begin());
+
+    EXPECT_TRUE(result == target.begin() + 8);
+    EXPECT_THAT(target, ::testing::ContainerEq(std::vector<int>({2,3,4,5,6,7,8,9,0,0})));
+}
+
+TEST(SegmentedIterator, TestFill) {
+    SmallBlockContainer container = MakeBlockContainer(10);
+
+    tmc::foundation::fill(container.begin() + 2, container.begin() + 9, 0);
+
+    EXPECT_THAT(std::vector<int>(container.begin(), container.end()), ::testing::ContainerEq(std::vector<int>({1,2,0,0,0,0,0,0,0,10})));
+}
+
+TEST(SegmentedIterator, TestFind) {
+    SmallBlockContainer container = MakeBlockContainer(12);
+
+    EXPECT_TRUE(tmc::foundation::find(container.begin(), container.end(), 1) == container.begin());
+    EXPECT_TRUE(tmc::foundation::find(container.begin(), container.end(), 4) == container.begin() + 3);
+    EXPECT_TRUE(tmc::foundation::find(container.begin(), container.end(), 9) == container.begin() + 8);
+    EXPECT_TRUE(tmc::foundation::find(container.begin(), container.end(), 12) == container.begin() + 11);
+    EXPECT_TRUE(tmc::foundation::find(container.begin(), container.end(), 13) == container.end());
+    EXPECT_TRUE(tmc::foundation::find(container.begin() + 5, container.begin() + 7, 9) == container.begin() + 7);
+    EXPECT_EQ(*tmc::foundation::find(container.cbegin(), container.cend(), 6), 6);
+}
+
+TEST(SegmentedIterator, TestCount) {
+    SmallBlockContainer container = MakeBlockContainer(12);
+    tmc::foundation::fill(container.begin() + 3, container.begin() + 10, 5);
+
+    EXPECT_EQ(tmc::foundation::count(container.begin(), container.end(), 5), 7);
+    EXPECT_EQ(tmc::foundation::count(container.begin() + 1, container.begin() + 3, 2), 1);
+    EXPECT_EQ(tmc::foundation::count(container.cbegin(), container.cend(), 13), 0);
+}
+
+TEST(SegmentedIterator, TestFallbackForNonSegmentedIterators) {
+    CustomContainerWithForwardIterator container{1,2,3};
+    std::vector<int> values{1,2,3};
+
+    std::vector<CustomElement> target(3);
+    tmc::foundation::copy(container.begin(), container.end(), target.begin());
+
+    EXPECT_EQ(tmc::foundation::accumulate(values.begin(), values.end(), 0), 6);
+    EXPECT_EQ(tmc::foundation::count(values.begin(), values.end(), 2), 1);
+    EXPECT_TRUE(tmc::foundation::find(container.begin(), container.end(), CustomElement(2)) == ++container.begin());
+    EXPECT_THAT(target, ::testing::ContainerEq(std::vector<CustomElement>({1,2,3})));
+
+    tmc::foundation::fill(values.begin(), values.end(), 7);
+    EXPECT_THAT(values, ::testing::ContainerEq(std::vector<int>({7,7,7})));
+}
+
+TEST(SegmentedIterator, TestPushBackAdvancesTheGeneration) {
+    SmallBlockContainer container = MakeBlockContainer(3);
+    const auto generation = [&container]() { return custom_iterator_access::state(container.cbegin()).generation(); };
+    const std::size_t initial = generation();
+
+    // The fourth element fills the block, the fifth one appends a block and moves the block table
+    container.push_back(4);
+    EXPECT_EQ(generation(), initial + 1);
+    container.push_back(5);
+    EXPECT_EQ(generation(), initial + 2);
+    EXPECT_EQ(*(container.begin() + 4), 5);
+}
@@ -0,0 +1,127 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/strided-iterator.hpp>
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+// Array of structs with the scanned field in the middle
+struct StridedRecord {
+    int64_t key;
+    int value;
+    double payload;
+};
+
+static std::vector<StridedRecord> MakeRecords(std::initializer_list<int> values) {
+    std::vector<StridedRecord> records;
+    int64_t key = 100;
+    for (int value: values) {
+        records.push_back(StridedRecord{key++, value, 0.5});
+    }
+    return records;
+}
+
+template<typename TRange>
+static std::vector<int> Values(const TRange &range) {
+    return std::vector<int>(range.begin(), range.end());
+}
+
+typedef strided_range<int, sizeof(StridedRecord)> StaticStridedRange;
+typedef strided_range<int> DynamicStridedRange;
+
+static_assert(sizeof(StaticStridedRange::iterator) == 2 * sizeof(void *), "Compile time strides must not be stored");
+static_assert(sizeof(DynamicStridedRange::iterator) == 3 * sizeof(void *), "Runtime strides are stored in the state");
+static_assert(std::is_trivially_copyable<StaticStridedRange::iterator>::value, "Strided iterators must be trivially copyable");
+static_assert(std::is_same<decltype(make_field_range(std::declval<StridedRecord *>(), 0, &StridedRecord::value)), StaticStridedRange>::value, "Field ranges must have a compile time stride");
+
+#if __cplusplus >= 202002L
+static_assert(std::random_access_iterator<StaticStridedRange::iterator>, "Strided iterators must be random access iterators");
+static_assert(std::random_access_iterator<DynamicStridedRange::const_iterator>, "Strided iterators must be random access iterators");
+static_assert(std::ranges::view<StaticStridedRange> && std::ranges::borrowed_range<StaticStridedRange>, "Strided ranges must be borrowed views");
+#endif
+
+TEST(StridedIterator, TestFieldRangeIteration) {
+    auto records = MakeRecords({5,3,8,1});
+    auto values = make_field_range(records.data(), records.size(), &StridedRecord::value);
+
+    EXPECT_EQ(values.size(), 4u);
+    EXPECT_EQ(values.stride(), static_cast<std::ptrdiff_t>(sizeof(StridedRecord)));
+    EXPECT_THAT(Values(values), ::testing::ContainerEq(std::vector<int>({5,3,8,1})));
+    EXPECT_THAT(std::vector<int>(values.rbegin(), values.rend()), ::testing::ContainerEq(std::vector<int>({1,8,3,5})));
+    EXPECT_EQ(std::accumulate(values.cbegin(), values.cend(), 0), 17);
+}
+
+TEST(StridedIterator, TestRandomAccess) {
+    auto records = MakeRecords({5,3,8,1,9});
+    StaticStridedRange values(&records[0].value, records.size());
+
+    auto it = values.begin();
+    it += 3;
+    EXPECT_EQ(*it, 1);
+    EXPECT_EQ(it[1], 9);
+    EXPECT_EQ(*(it - 2), 3);
+    EXPECT_EQ(values.end() - values.begin(), 5);
+    EXPECT_EQ(values.cend() - it, 2);
+    EXPECT_TRUE(values.begin() < it);
+    EXPECT_TRUE(values.begin() + 5 == values.end());
+    EXPECT_EQ(&*it, &records[3].value);
+}
+
+TEST(StridedIterator, TestRuntimeStride) {
+    auto records = MakeRecords({5,3,8,1,9});
+    DynamicStridedRange everySecond(&records[0].value, 3, 2 * sizeof(StridedRecord));
+
+    EXPECT_EQ(everySecond.stride(), static_cast<std::ptrdiff_t>(2 * sizeof(StridedRecord)));
+    EXPECT_THAT(Values(everySecond), ::testing::ContainerEq(std::vector<int>({5,8,9})));
+    EXPECT_EQ(everySecond.end() - everySecond.begin(), 3);
+    EXPECT_EQ(everySecond.begin()[2], 9);
+
+    EXPECT_THROW(DynamicStridedRange(&records[0].value, 3, 0), std::invalid_argument);
+}
+
+TEST(StridedIterator, TestAlgorithmsWriteTheField) {
+    auto records = MakeRecords({5,3,8,1});
+    auto values = make_field_range(records.data(), records.size(), &StridedRecord::value);
+
+    std::sort(values.begin(), values.end());
+    EXPECT_THAT(Values(values), ::testing::ContainerEq(std::vector<int>({1,3,5,8})));
+    EXPECT_EQ(records[0].key, 100);
+    EXPECT_EQ(records[3].key, 103);
+
+    std::fill(values.begin() + 1, values.end() - 1, 0);
+    EXPECT_THAT(Values(values), ::testing::ContainerEq(std::vector<int>({1,0,0,8})));
+    EXPECT_TRUE(std::lower_bound(values.begin(), values.end(), 8) == values.end() - 1);
+}
+
+TEST(StridedIterator, TestConstAndEmptyRanges) {
+    const auto records = MakeRecords({2,4});
+    auto values = make_field_range(records.data(), records.size(), &StridedRecord::value);
+    StaticStridedRange empty;
+    auto emptyField = make_field_range(static_cast<StridedRecord *>(nullptr), 0, &StridedRecord::value);
+
+    static_assert(std::is_same<decltype(*values.begin()), const int &>::value, "Field ranges of const structs must be const");
+    EXPECT_THAT(Values(values), ::testing::ContainerEq(std::vector<int>({2,4})));
+    EXPECT_TRUE(empty.begin() == empty.end());
+    EXPECT_TRUE(emptyField.empty());
+    EXPECT_TRUE(emptyField.begin() == emptyField.end());
+}
+
+TEST(StridedIterator, TestConstConversion) {
+    auto records = MakeRecords({2,4});
+    StaticStridedRange values(&records[0].value, records.size());
+
+    StaticStridedRange::const_iterator it = values.begin();
+    EXPECT_TRUE(it == values.begin());
+    EXPECT_EQ(*it, 2);
+}
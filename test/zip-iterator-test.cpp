@@ -0,0 +1,115 @@
+// Copyright Thomas Maierhofer Consulting, Bad Waldsee, Germany
+// Licensed under MIT
+
+#include <algorithm>
+#include <list>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <gmock/gmock-matchers.h>
+#include <tmc/foundation/zip-iterator.hpp>
+#include "custom-container-skeletons.hpp"
+
+using namespace std;
+using namespace testing;
+using namespace tmc::foundation;
+
+typedef decltype(make_zip_range(std::declval<std::vector<int> &>(), std::declval<CustomContainerWithTrivialIteratorState &>())) RandomAccessZip;
+typedef decltype(make_zip_range(std::declval<std::vector<int> &>(), std::declval<CustomContainerWithBidirectionalIterator &>())) BidirectionalZip;
+typedef decltype(make_zip_range(std::declval<CustomContainerWithRandomAccessIterator &>(), std::declval<CustomContainerWithForwardIterator &>(), std::declval<std::vector<int> &>())) ForwardZip;
+typedef decltype(make_zip_range(std::declval<std::vector<int> &>(), std::declval<CustomContainerWithInputIterator &>())) InputZip;
+
+static_assert(std::is_same<RandomAccessZip::iterator::iterator_category, std::random_access_iterator_tag>::value, "The weakest category must be propagated");
+static_assert(std::is_same<BidirectionalZip::iterator::iterator_category, std::bidirectional_iterator_tag>::value, "The weakest category must be propagated");
+static_assert(std::is_same<ForwardZip::iterator::iterator_category, std::forward_iterator_tag>::value, "The weakest category must be propagated");
+static_assert(std::is_same<InputZip::iterator::iterator_category, std::input_iterator_tag>::value, "The weakest category must be propagated");
+static_assert(std::is_same<RandomAccessZip::iterator::reference, std::tuple<int &, CustomElement &>>::value, "Zip iterators must return a tuple of references");
+static_assert(std::is_same<RandomAccessZip::iterator::value_type, std::tuple<int, CustomElement>>::value, "Zip iterators must have a tuple of values as value type");
+static_assert(std::is_trivially_copyable<decltype(make_zip_range(std::declval<int (&)[3]>(), std::declval<double (&)[3]>()))::iterator>::value, "Zip iterators of pointers must be trivially copyable");
+
+#if __cplusplus >= 202002L
+static_assert(std::random_access_iterator<RandomAccessZip::iterator>, "Zip iterators of random access iterators must be random access iterators");
+static_assert(std::ranges::view<RandomAccessZip> && std::ranges::borrowed_range<RandomAccessZip>, "Zip ranges must be borrowed views");
+#endif
+
+TEST(ZipIterator, TestLockstepIteration) {
+    std::vector<int> keys{1,2,3};
+    CustomContainerWithTrivialIteratorState values{10,20,30};
+
+    std::vector<int> sums;
+    for (auto [key, value]: make_zip_range(keys, values)) {
+        sums.push_back(key + value.GetValue());
+    }
+
+    EXPECT_THAT(sums, ::testing::ContainerEq(std::vector<int>({11,22,33})));
+}
+
+TEST(ZipIterator, TestWritesThroughTheReferences) {
+    int a[] = {1,2,3};
+    int b[] = {4,5,6};
+    int c[] = {0,0,0};
+
+    for (auto [x, y, z]: make_zip_range(c, a, b)) {
+        x = y * z;
+    }
+    auto zip = make_zip_range(a, b);
+    std::get<1>(*zip.begin()) = 40;
+
+    EXPECT_THAT(c, ::testing::ElementsAre(4,10,18));
+    EXPECT_EQ(b[0], 40);
+}
+
+TEST(ZipIterator, TestFirstRangeDesignatesTheEnd) {
+    std::vector<int> shorter{1,2};
+    std::vector<int> longer{10,20,30,40};
+
+    auto zip = make_zip_range(shorter, longer);
+
+    EXPECT_EQ(std::distance(zip.begin(), zip.end()), 2);
+    EXPECT_EQ(std::get<1>(zip.begin()[1]), 20);
+}
+
+TEST(ZipIterator, TestRandomAccess) {
+    std::vector<int> keys{1,2,3,4};
+    CustomContainerWithTrivialIteratorState values{10,20,30,40};
+    auto zip = make_zip_range(keys, values);
+
+    auto it = zip.begin() + 3;
+    EXPECT_EQ(std::get<0>(*it), 4);
+    EXPECT_EQ(std::get<1>(it[-2]).GetValue(), 20);
+    EXPECT_EQ(zip.end() - zip.begin(), 4);
+    EXPECT_TRUE(zip.begin() < it);
+    EXPECT_TRUE(zip.cbegin() + 4 == zip.end());
+    EXPECT_EQ(std::get<0>(*--it), 3);
+
+    *it = *zip.begin();
+    EXPECT_EQ(keys[2], 1);
+    EXPECT_EQ(values.InternalData[2].GetValue(), 10);
+}
+
+TEST(ZipIterator, TestForwardAndBidirectionalRanges) {
+    std::list<int> keys{1,2,3};
+    CustomContainerWithBidirectionalIterator values{10,20,30};
+    CustomContainerWithForwardIterator weights{7,8,9};
+
+    auto bidirectional = make_zip_range(keys, values);
+    auto last = bidirectional.end();
+    --last;
+    auto forward = make_zip_range(weights, keys);
+
+    EXPECT_EQ(std::get<0>(*last), 3);
+    EXPECT_EQ(std::get<1>(*last).GetValue(), 30);
+    EXPECT_EQ(std::distance(forward.begin(), forward.end()), 3);
+    EXPECT_TRUE(std::find_if(forward.begin(), forward.end(), [](const auto &element) { return std::get<1>(element) == 2; }) == ++forward.begin());
+}
+
+TEST(ZipIterator, TestEmptyRanges) {
+    std::vector<int> keys;
+    std::vector<double> values;
+    auto zip = make_zip_range(keys, values);
+
+    EXPECT_TRUE(zip.begin() == zip.end());
+}